@@ -37,13 +37,51 @@
 
 #define SB_HEADER_SIZE      12
 
+/* Streamed block transfers.
+ *
+ * The header carries the start address, the block size and the total length
+ * in place of the value. The host then sends (STREAM_WRITE) or receives
+ * (STREAM_READ) frames without waiting for a reply to each block:
+ *
+ *   STREAM_WRITE  host -> bridge  [seq][block]
+ *                 bridge -> host  [ACK][seq] after each window and the last block
+ *                                 [NACK][last good seq] on error, stream ends
+ *
+ *   STREAM_READ   bridge -> host  [ACK][seq][block], or [NACK][seq] on error
+ *                 host -> bridge  [ACK][seq] after each window to release the next
+ *
+ * Sequence numbers start at zero for each stream and wrap at 256. STREAM_READ
+ * frames are passed to the UART in chunks as the transmit buffer drains, so
+ * blocks may be larger than the transmit buffer.
+ */
+/* Compressed block writes.
+ *
+ * WRITE_BLOCK_RLE carries a PackBits encoded payload, the header size is the
+ * encoded length and the value is the decoded length, both limited to
+ * SB_CMD_BUFFER_SIZE. Each control byte n is followed by:
+ *
+ *   0 to 127     n+1 literal bytes
+ *   129 to 255   one byte repeated 257-n times
+ *   128          nothing, skipped
+ *
+ * The block is written to the WINC only if it decodes to exactly the value
+ * length, the reply is ACK or NACK as for WRITE_BLOCK.
+ */
+
+#define SB_STREAM_FRAME_HDR_SIZE    2
+#define SB_STREAM_BLOCK_MAX         (SB_CMD_BUFFER_SIZE - SB_STREAM_FRAME_HDR_SIZE)
+#define SB_STREAM_TX_CHUNK          64
+
 typedef enum
 {
     SB_COMMAND_READ_REG_WITH_RET = 0,
     SB_COMMAND_WRITE_REG         = 1,
     SB_COMMAND_READ_BLOCK        = 2,
     SB_COMMAND_WRITE_BLOCK       = 3,
-    SB_COMMAND_RECONFIGURE       = 5
+    SB_COMMAND_RECONFIGURE       = 5,
+    SB_COMMAND_STREAM_WRITE      = 6,
+    SB_COMMAND_STREAM_READ       = 7,
+    SB_COMMAND_WRITE_BLOCK_RLE   = 8
 } SB_COMMAND;
 
 typedef enum
@@ -90,6 +128,25 @@ static bool _ProcessHeader(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState, u
             return false;
         }
     }
+    else if (pSBDecoderState->cmdType == SB_COMMAND_WRITE_BLOCK_RLE)
+    {
+        pSBDecoderState->payloadLength = pSBDecoderState->cmdSize;
+
+        if ((0 == pSBDecoderState->payloadLength) || (pSBDecoderState->payloadLength > SB_CMD_BUFFER_SIZE) ||
+            (0 == pSBDecoderState->cmdVal) || (pSBDecoderState->cmdVal > SB_CMD_BUFFER_SIZE))
+        {
+            return false;
+        }
+    }
+    else if ((pSBDecoderState->cmdType == SB_COMMAND_STREAM_WRITE) || (pSBDecoderState->cmdType == SB_COMMAND_STREAM_READ))
+    {
+        pSBDecoderState->payloadLength = 0;
+
+        if ((0 == pSBDecoderState->cmdSize) || (pSBDecoderState->cmdSize > SB_STREAM_BLOCK_MAX) || (0 == pSBDecoderState->cmdVal))
+        {
+            return false;
+        }
+    }
     else
     {
         pSBDecoderState->payloadLength = 0;
@@ -98,6 +155,52 @@ static bool _ProcessHeader(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState, u
     return true;
 }
 
+static bool _DecodeRLE(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
+{
+    const uint8_t *pIn    = pSBDecoderState->dataBuf;
+    const uint8_t *pInEnd = &pSBDecoderState->dataBuf[pSBDecoderState->cmdSize];
+    uint8_t *pOut         = pSBDecoderState->decodeBuf;
+    uint8_t *pOutEnd      = &pSBDecoderState->decodeBuf[pSBDecoderState->cmdVal];
+
+    while (pIn < pInEnd)
+    {
+        uint8_t ctrl = *pIn++;
+        size_t len;
+
+        if (ctrl < 128)
+        {
+            len = (size_t)ctrl + 1;
+
+            if ((len > (size_t)(pInEnd - pIn)) || (len > (size_t)(pOutEnd - pOut)))
+            {
+                return false;
+            }
+
+            memcpy(pOut, pIn, len);
+            pIn += len;
+        }
+        else if (ctrl > 128)
+        {
+            len = 257 - (size_t)ctrl;
+
+            if ((pIn == pInEnd) || (len > (size_t)(pOutEnd - pOut)))
+            {
+                return false;
+            }
+
+            memset(pOut, *pIn++, len);
+        }
+        else
+        {
+            continue;
+        }
+
+        pOut += len;
+    }
+
+    return (pOut == pOutEnd);
+}
+
 static bool _ProcessCommand(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
 {
     uint_fast16_t cnt;
@@ -146,6 +249,9 @@ static bool _ProcessCommand(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
 
                 if (false == SerialBridge_PlatformUARTWritePutBuffer(pSBDecoderState->dataBuf, SB_CMD_BUFFER_SIZE))
                     return false;
+
+                pSBDecoderState->cmdAddr += SB_CMD_BUFFER_SIZE;
+                cnt -= SB_CMD_BUFFER_SIZE;
             }
 
             if (cnt)
@@ -153,7 +259,7 @@ static bool _ProcessCommand(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
                 if (M2M_SUCCESS != nm_read_block(pSBDecoderState->cmdAddr, pSBDecoderState->dataBuf, cnt))
                     return false;
 
-                if (false == SerialBridge_PlatformUARTWritePutBuffer(pSBDecoderState->dataBuf, pSBDecoderState->cmdSize))
+                if (false == SerialBridge_PlatformUARTWritePutBuffer(pSBDecoderState->dataBuf, cnt))
                     return false;
             }
 
@@ -174,6 +280,21 @@ static bool _ProcessCommand(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
             return SerialBridge_PlatformUARTWritePutBuffer(pSBDecoderState->dataBuf, 1);
         }
 
+        case SB_COMMAND_WRITE_BLOCK_RLE:
+        {
+            if ((true == _DecodeRLE(pSBDecoderState)) &&
+                (M2M_SUCCESS == nm_write_block(pSBDecoderState->cmdAddr, pSBDecoderState->decodeBuf, pSBDecoderState->cmdVal)))
+            {
+                pSBDecoderState->dataBuf[0] = SB_RESPONSE_ACK;
+            }
+            else
+            {
+                pSBDecoderState->dataBuf[0] = SB_RESPONSE_NACK;
+            }
+
+            return SerialBridge_PlatformUARTWritePutBuffer(pSBDecoderState->dataBuf, 1);
+        }
+
         case SB_COMMAND_RECONFIGURE:
         {
             SerialBridge_PlatformUARTSetBaudRate(pSBDecoderState->cmdVal);
@@ -190,6 +311,169 @@ static bool _ProcessCommand(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
     return true;
 }
 
+static uint16_t _StreamBlockSize(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
+{
+    if (pSBDecoderState->streamRemain < pSBDecoderState->cmdSize)
+    {
+        return (uint16_t)pSBDecoderState->streamRemain;
+    }
+
+    return pSBDecoderState->cmdSize;
+}
+
+static void _StreamSendResponse(uint8_t response, uint8_t seq)
+{
+    uint8_t rsp[SB_STREAM_FRAME_HDR_SIZE];
+
+    rsp[0] = response;
+    rsp[1] = seq;
+
+    SerialBridge_PlatformUARTWritePutBuffer(rsp, SB_STREAM_FRAME_HDR_SIZE);
+}
+
+static void _StreamStart(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
+{
+    pSBDecoderState->streamRemain = pSBDecoderState->cmdVal;
+    pSBDecoderState->streamSeq    = 0;
+    pSBDecoderState->streamWinCnt = 0;
+    pSBDecoderState->rxDataLen    = 0;
+    pSBDecoderState->txLen        = 0;
+
+    if (pSBDecoderState->cmdType == SB_COMMAND_STREAM_WRITE)
+    {
+        pSBDecoderState->payloadLength = 1 + _StreamBlockSize(pSBDecoderState);
+        pSBDecoderState->state         = SERIAL_BRIDGE_STATE_STREAM_WRITE;
+    }
+    else
+    {
+        pSBDecoderState->state = SERIAL_BRIDGE_STATE_STREAM_READ;
+    }
+}
+
+static void _StreamWrite(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
+{
+    uint16_t blkSize;
+
+    pSBDecoderState->rxDataLen += SerialBridge_PlatformUARTReadGetBuffer(&pSBDecoderState->dataBuf[pSBDecoderState->rxDataLen], pSBDecoderState->payloadLength - pSBDecoderState->rxDataLen);
+
+    if (pSBDecoderState->payloadLength != pSBDecoderState->rxDataLen)
+    {
+        return;
+    }
+
+    blkSize = pSBDecoderState->payloadLength - 1;
+
+    if ((pSBDecoderState->dataBuf[0] != pSBDecoderState->streamSeq) ||
+        (M2M_SUCCESS != nm_write_block(pSBDecoderState->cmdAddr, &pSBDecoderState->dataBuf[1], blkSize)))
+    {
+        /* The host resumes with a new stream after the last good block. */
+        _StreamSendResponse(SB_RESPONSE_NACK, pSBDecoderState->streamSeq - 1);
+        pSBDecoderState->state = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+        return;
+    }
+
+    pSBDecoderState->cmdAddr      += blkSize;
+    pSBDecoderState->streamRemain -= blkSize;
+    pSBDecoderState->streamSeq++;
+    pSBDecoderState->streamWinCnt++;
+
+    if ((0 == pSBDecoderState->streamRemain) || (SB_STREAM_WINDOW == pSBDecoderState->streamWinCnt))
+    {
+        _StreamSendResponse(SB_RESPONSE_ACK, pSBDecoderState->streamSeq - 1);
+        pSBDecoderState->streamWinCnt = 0;
+    }
+
+    if (0 == pSBDecoderState->streamRemain)
+    {
+        pSBDecoderState->state = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+        return;
+    }
+
+    pSBDecoderState->rxDataLen     = 0;
+    pSBDecoderState->payloadLength = 1 + _StreamBlockSize(pSBDecoderState);
+}
+
+static void _StreamRead(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
+{
+    uint16_t blkSize;
+
+    if (0 == pSBDecoderState->txLen)
+    {
+        blkSize = _StreamBlockSize(pSBDecoderState);
+
+        pSBDecoderState->dataBuf[0] = SB_RESPONSE_ACK;
+        pSBDecoderState->dataBuf[1] = pSBDecoderState->streamSeq;
+
+        if (M2M_SUCCESS != nm_read_block(pSBDecoderState->cmdAddr, &pSBDecoderState->dataBuf[SB_STREAM_FRAME_HDR_SIZE], blkSize))
+        {
+            _StreamSendResponse(SB_RESPONSE_NACK, pSBDecoderState->streamSeq);
+            pSBDecoderState->state = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+            return;
+        }
+
+        pSBDecoderState->txLen    = SB_STREAM_FRAME_HDR_SIZE + blkSize;
+        pSBDecoderState->txOffset = 0;
+    }
+
+    /* Queue the frame as space becomes available, retrying on the next call
+     * while the transmit buffer is full. */
+    while (pSBDecoderState->txOffset < pSBDecoderState->txLen)
+    {
+        uint16_t chunk = pSBDecoderState->txLen - pSBDecoderState->txOffset;
+
+        if (chunk > SB_STREAM_TX_CHUNK)
+        {
+            chunk = SB_STREAM_TX_CHUNK;
+        }
+
+        if (false == SerialBridge_PlatformUARTWritePutBuffer(&pSBDecoderState->dataBuf[pSBDecoderState->txOffset], chunk))
+        {
+            return;
+        }
+
+        pSBDecoderState->txOffset += chunk;
+    }
+
+    blkSize = pSBDecoderState->txLen - SB_STREAM_FRAME_HDR_SIZE;
+
+    pSBDecoderState->txLen = 0;
+
+    pSBDecoderState->cmdAddr      += blkSize;
+    pSBDecoderState->streamRemain -= blkSize;
+    pSBDecoderState->streamSeq++;
+    pSBDecoderState->streamWinCnt++;
+
+    if (0 == pSBDecoderState->streamRemain)
+    {
+        pSBDecoderState->state = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+    }
+    else if (SB_STREAM_WINDOW == pSBDecoderState->streamWinCnt)
+    {
+        pSBDecoderState->streamWinCnt = 0;
+        pSBDecoderState->rxDataLen    = 0;
+        pSBDecoderState->state        = SERIAL_BRIDGE_STATE_STREAM_WAIT_ACK;
+    }
+}
+
+static void _StreamWaitAck(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
+{
+    pSBDecoderState->rxDataLen += SerialBridge_PlatformUARTReadGetBuffer(&pSBDecoderState->dataBuf[pSBDecoderState->rxDataLen], SB_STREAM_FRAME_HDR_SIZE - pSBDecoderState->rxDataLen);
+
+    if (SB_STREAM_FRAME_HDR_SIZE != pSBDecoderState->rxDataLen)
+    {
+        return;
+    }
+
+    if ((SB_RESPONSE_ACK == pSBDecoderState->dataBuf[0]) && ((uint8_t)(pSBDecoderState->streamSeq - 1) == pSBDecoderState->dataBuf[1]))
+    {
+        pSBDecoderState->state = SERIAL_BRIDGE_STATE_STREAM_READ;
+    }
+    else
+    {
+        pSBDecoderState->state = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+    }
+}
+
 void SerialBridge_Init(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState, uint32_t baudRate)
 {
     if (NULL == pSBDecoderState)
@@ -265,7 +549,11 @@ void SerialBridge_Process(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
             {
                 SerialBridge_PlatformUARTWritePutByte(SB_RESPONSE_ACK);
 
-                if (pSBDecoderState->payloadLength > 0)
+                if ((pSBDecoderState->cmdType == SB_COMMAND_STREAM_WRITE) || (pSBDecoderState->cmdType == SB_COMMAND_STREAM_READ))
+                {
+                    _StreamStart(pSBDecoderState);
+                }
+                else if (pSBDecoderState->payloadLength > 0)
                 {
                     pSBDecoderState->state = SERIAL_BRIDGE_STATE_WAIT_PAYLOAD;
                     pSBDecoderState->rxDataLen = 0;
@@ -306,6 +594,24 @@ void SerialBridge_Process(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState)
             break;
         }
 
+        case SERIAL_BRIDGE_STATE_STREAM_WRITE:
+        {
+            _StreamWrite(pSBDecoderState);
+            break;
+        }
+
+        case SERIAL_BRIDGE_STATE_STREAM_READ:
+        {
+            _StreamRead(pSBDecoderState);
+            break;
+        }
+
+        case SERIAL_BRIDGE_STATE_STREAM_WAIT_ACK:
+        {
+            _StreamWaitAck(pSBDecoderState);
+            break;
+        }
+
         default:
         {
             break;
@@ -35,6 +35,7 @@ extern "C" {
 #endif
 
 #define SB_CMD_BUFFER_SIZE  2048
+#define SB_STREAM_WINDOW    8
 
 typedef enum
 {
@@ -43,6 +44,9 @@ typedef enum
     SERIAL_BRIDGE_STATE_WAIT_HEADER,
     SERIAL_BRIDGE_STATE_PROCESS_COMMAND,
     SERIAL_BRIDGE_STATE_WAIT_PAYLOAD,
+    SERIAL_BRIDGE_STATE_STREAM_WRITE,
+    SERIAL_BRIDGE_STATE_STREAM_READ,
+    SERIAL_BRIDGE_STATE_STREAM_WAIT_ACK,
 } SERIAL_BRIDGE_STATE;
 
 typedef struct
@@ -50,12 +54,18 @@ typedef struct
     SERIAL_BRIDGE_STATE state;
     uint32_t            baudRate;
     uint8_t             dataBuf[SB_CMD_BUFFER_SIZE];
+    uint8_t             decodeBuf[SB_CMD_BUFFER_SIZE];
     uint16_t            rxDataLen;
     uint8_t             cmdType;
     uint16_t            cmdSize;
     uint32_t            cmdAddr;
     uint32_t            cmdVal;
     uint16_t            payloadLength;
+    uint32_t            streamRemain;
+    uint8_t             streamSeq;
+    uint8_t             streamWinCnt;
+    uint16_t            txLen;
+    uint16_t            txOffset;
 } SERIAL_BRIDGE_DECODER_STATE;
 
 void SerialBridge_Init(SERIAL_BRIDGE_DECODER_STATE *const pSBDecoderState, uint32_t baudRate);
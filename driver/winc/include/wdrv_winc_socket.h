@@ -59,6 +59,9 @@ Microchip or any third party.
 #include "wdrv_winc_httpprovctx.h"
 #ifndef WDRV_WINC_DEVICE_LITE_DRIVER
 #include "socket.h"
+#if defined(CONF_WINC_SOCKET_STATS) && defined(WDRV_WINC_DEVICE_SOCKET_STATS)
+#include "m2m_hif.h"
+#endif
 #endif
 
 // DOM-IGNORE-BEGIN
@@ -987,6 +990,123 @@ WDRV_WINC_STATUS WDRV_WINC_SocketRegisterResolverCallback
     tpfAppResolveCb pfAppResolveCb
 );
 
+#if defined(CONF_WINC_SOCKET_STATS) && defined(WDRV_WINC_DEVICE_SOCKET_STATS) && !defined(WDRV_WINC_DEVICE_LITE_DRIVER)
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SocketStatsGet
+    (
+        DRV_HANDLE handle,
+        SOCKET sock,
+        tstrSockStats *pStats
+    )
+
+  Summary:
+    Retrieve socket statistics counters.
+
+  Description:
+    Copies the traffic and callback latency counters for a single socket, or
+    the aggregate counters for all sockets if sock is SOCKET_STATS_ALL.
+
+  Precondition:
+    WDRV_WINC_Initialize should have been called.
+    WDRV_WINC_Open should have been called to obtain a valid handle.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+    sock   - Socket ID or SOCKET_STATS_ALL.
+    pStats - Pointer to structure to receive the statistics.
+
+  Returns:
+    WDRV_WINC_STATUS_OK          - The request has been executed successfully.
+    WDRV_WINC_STATUS_NOT_OPEN    - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG - The parameters were incorrect.
+
+  Remarks:
+    Only available with the WINC1500 19.7.7 driver when CONF_WINC_SOCKET_STATS
+    is defined.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SocketStatsGet
+(
+    DRV_HANDLE handle,
+    SOCKET sock,
+    tstrSockStats *pStats
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_HIFStatsGet
+    (
+        DRV_HANDLE handle,
+        tstrHifStats *pStats
+    )
+
+  Summary:
+    Retrieve host interface statistics counters.
+
+  Description:
+    Copies the HIF send, chip wake and DMA address polling counters.
+
+  Precondition:
+    WDRV_WINC_Initialize should have been called.
+    WDRV_WINC_Open should have been called to obtain a valid handle.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+    pStats - Pointer to structure to receive the statistics.
+
+  Returns:
+    WDRV_WINC_STATUS_OK          - The request has been executed successfully.
+    WDRV_WINC_STATUS_NOT_OPEN    - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG - The parameters were incorrect.
+
+  Remarks:
+    Only available with the WINC1500 19.7.7 driver when CONF_WINC_SOCKET_STATS
+    is defined.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_HIFStatsGet
+(
+    DRV_HANDLE handle,
+    tstrHifStats *pStats
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_StatsReset(DRV_HANDLE handle)
+
+  Summary:
+    Reset all socket and HIF statistics counters.
+
+  Description:
+    Clears the per-socket, aggregate socket and HIF statistics counters.
+
+  Precondition:
+    WDRV_WINC_Initialize should have been called.
+    WDRV_WINC_Open should have been called to obtain a valid handle.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+
+  Returns:
+    WDRV_WINC_STATUS_OK          - The request has been executed successfully.
+    WDRV_WINC_STATUS_NOT_OPEN    - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG - The parameters were incorrect.
+
+  Remarks:
+    Only available with the WINC1500 19.7.7 driver when CONF_WINC_SOCKET_STATS
+    is defined.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_StatsReset(DRV_HANDLE handle);
+#endif
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
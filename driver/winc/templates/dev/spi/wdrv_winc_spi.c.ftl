@@ -62,6 +62,12 @@ typedef struct
 </#if>
     OSAL_SEM_HANDLE_TYPE    txSyncSem;
     OSAL_SEM_HANDLE_TYPE    rxSyncSem;
+<#else>
+    /* Completion callback of the current asynchronous transfer, if any. */
+    WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB;
+    uintptr_t               transferCBCtx;
+    /* Set by the DMA event handler if the current transfer failed. */
+    volatile bool           transferError;
 </#if>
 } WDRV_WINC_SPIDCPT;
 
@@ -89,6 +95,56 @@ static CACHE_ALIGN uint8_t alignedBuffer[CACHE_ALIGNED_SIZE_GET(2048)];
 // *****************************************************************************
 
 <#if DRV_WIFI_WINC_TX_RX_DMA == true>
+static void spiDMAEventHandler(SYS_DMA_TRANSFER_EVENT event, uintptr_t context)
+{
+    WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB = spiDcpt.pfTransferCB;
+    bool success = (SYS_DMA_TRANSFER_COMPLETE == event);
+
+    if (false == success)
+    {
+        /* Stop both channels, the other may still be running. */
+        SYS_DMA_ChannelDisable(spiDcpt.cfg.txDMAChannel);
+        SYS_DMA_ChannelDisable(spiDcpt.cfg.rxDMAChannel);
+
+        spiDcpt.transferError = true;
+    }
+
+    if (NULL == pfTransferCB)
+    {
+        return;
+    }
+
+    /* Clear before calling so the callback can chain the next transfer. */
+    spiDcpt.pfTransferCB = NULL;
+
+    pfTransferCB(spiDcpt.transferCBCtx, success);
+}
+
+static void spiDMATxEventHandler(SYS_DMA_TRANSFER_EVENT event, uintptr_t context)
+{
+    /* Completion is reported by the RX channel, only errors are handled here. */
+    if (SYS_DMA_TRANSFER_COMPLETE != event)
+    {
+        spiDMAEventHandler(event, context);
+    }
+}
+
+static void spiDMATransferStart(void* pTxData, bool txIncrement, void* pRxData, bool rxIncrement, size_t size)
+{
+    spiDcpt.transferError = false;
+
+    /* Configure the RX DMA channel */
+    SYS_DMA_AddressingModeSetup(spiDcpt.cfg.rxDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED,
+            (true == rxIncrement) ? SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED : SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
+    SYS_DMA_ChannelTransfer(spiDcpt.cfg.rxDMAChannel, (const void*)spiDcpt.cfg.rxAddress, pRxData, size);
+
+    /* Configure the TX DMA channel */
+    SYS_DMA_AddressingModeSetup(spiDcpt.cfg.txDMAChannel,
+            (true == txIncrement) ? SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED : SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED,
+            SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
+    SYS_DMA_ChannelTransfer(spiDcpt.cfg.txDMAChannel, pTxData, (const void*)spiDcpt.cfg.txAddress, size);
+}
+
 <#elseif drv_spi?? && DRV_WIFI_WINC_SPI_INST_IDX gte 0 >
 static void spiTransferEventHandler(DRV_SPI_TRANSFER_EVENT event,
         DRV_SPI_TRANSFER_HANDLE handle, uintptr_t context)
@@ -142,18 +198,17 @@ static void _DRV_SPI_PlibCallbackHandler(uintptr_t contextHandle)
 bool WDRV_WINC_SPISend(void* pTransmitData, size_t txSize)
 {
 <#if DRV_WIFI_WINC_TX_RX_DMA == true>
-
-    /* Configure the RX DMA channel - to receive dummy data */
-    SYS_DMA_AddressingModeSetup(spiDcpt.cfg.rxDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
-    SYS_DMA_ChannelTransfer(spiDcpt.cfg.rxDMAChannel, (const void*)spiDcpt.cfg.rxAddress, (const void *)dummyDataRx, txSize);
-
-    /* Configure the transmit DMA channel - to send data from transmit buffer */
-    SYS_DMA_AddressingModeSetup(spiDcpt.cfg.txDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_INCREMENTED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
-    SYS_DMA_ChannelTransfer(spiDcpt.cfg.txDMAChannel, pTransmitData, (const void*)spiDcpt.cfg.txAddress, txSize);
+    /* Send data from transmit buffer, receive dummy data */
+    spiDMATransferStart(pTransmitData, true, dummyDataRx, false, txSize);
 
     while (true == SYS_DMA_ChannelIsBusy(spiDcpt.cfg.rxDMAChannel))
     {
     }
+
+    if (true == spiDcpt.transferError)
+    {
+        return false;
+    }
 <#elseif drv_spi?? && DRV_WIFI_WINC_SPI_INST_IDX gte 0>
 <#if core.DATA_CACHE_ENABLE?? && core.DATA_CACHE_ENABLE == true && drv_spi.DRV_SPI_SYS_DMA_ENABLE == true>
     memcpy(alignedBuffer, pTransmitData, txSize);
@@ -205,17 +260,17 @@ bool WDRV_WINC_SPISend(void* pTransmitData, size_t txSize)
 bool WDRV_WINC_SPIReceive(void* pReceiveData, size_t rxSize)
 {
 <#if DRV_WIFI_WINC_TX_RX_DMA == true>
-    /* Configure the RX DMA channel - to receive data in receive buffer */
-    SYS_DMA_AddressingModeSetup(spiDcpt.cfg.rxDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED, SYS_DMA_DESTINATION_ADDRESSING_MODE_INCREMENTED);
-    SYS_DMA_ChannelTransfer(spiDcpt.cfg.rxDMAChannel, (const void*)spiDcpt.cfg.rxAddress, pReceiveData, rxSize);
-
-    /* Configure the TX DMA channel - to send dummy data */
-    SYS_DMA_AddressingModeSetup(spiDcpt.cfg.txDMAChannel, SYS_DMA_SOURCE_ADDRESSING_MODE_FIXED, SYS_DMA_DESTINATION_ADDRESSING_MODE_FIXED);
-    SYS_DMA_ChannelTransfer(spiDcpt.cfg.txDMAChannel, (const void *)dummyDataTx, (const void*)spiDcpt.cfg.txAddress, rxSize);
+    /* Receive data in receive buffer, send dummy data */
+    spiDMATransferStart(dummyDataTx, false, pReceiveData, true, rxSize);
 
     while (true == SYS_DMA_ChannelIsBusy(spiDcpt.cfg.rxDMAChannel))
     {
     }
+
+    if (true == spiDcpt.transferError)
+    {
+        return false;
+    }
 <#elseif drv_spi?? && DRV_WIFI_WINC_SPI_INST_IDX gte 0>
     static uint8_t dummy = 0;
 
@@ -255,6 +310,96 @@ bool WDRV_WINC_SPIReceive(void* pReceiveData, size_t rxSize)
 
     return true;
 }
+<#if DRV_WIFI_WINC_TX_RX_DMA == true>
+
+//*******************************************************************************
+/*
+  Function:
+    bool WDRV_WINC_SPISendAsync
+    (
+        void* pTransmitData,
+        size_t txSize,
+        WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+        uintptr_t context
+    )
+
+  Summary:
+    Starts sending data out to the module through the SPI bus.
+
+  Description:
+    This function starts a DMA transfer sending data out to the module through
+    the SPI bus and returns immediately.
+
+  Remarks:
+    See wdrv_winc_spi.h for usage information.
+ */
+
+bool WDRV_WINC_SPISendAsync
+(
+    void* pTransmitData,
+    size_t txSize,
+    WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+    uintptr_t context
+)
+{
+    if ((NULL == pTransmitData) || (NULL == pfTransferCB) || (NULL != spiDcpt.pfTransferCB))
+    {
+        return false;
+    }
+
+    spiDcpt.transferCBCtx = context;
+    spiDcpt.pfTransferCB  = pfTransferCB;
+
+    /* Send data from transmit buffer, receive dummy data */
+    spiDMATransferStart(pTransmitData, true, dummyDataRx, false, txSize);
+
+    return true;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    bool WDRV_WINC_SPIReceiveAsync
+    (
+        void* pReceiveData,
+        size_t rxSize,
+        WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+        uintptr_t context
+    )
+
+  Summary:
+    Starts receiving data from the module through the SPI bus.
+
+  Description:
+    This function starts a DMA transfer receiving data from the module through
+    the SPI bus and returns immediately.
+
+  Remarks:
+    See wdrv_winc_spi.h for usage information.
+ */
+
+bool WDRV_WINC_SPIReceiveAsync
+(
+    void* pReceiveData,
+    size_t rxSize,
+    WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+    uintptr_t context
+)
+{
+    if ((NULL == pReceiveData) || (NULL == pfTransferCB) || (NULL != spiDcpt.pfTransferCB))
+    {
+        return false;
+    }
+
+    spiDcpt.transferCBCtx = context;
+    spiDcpt.pfTransferCB  = pfTransferCB;
+
+    /* Receive data in receive buffer, send dummy data */
+    spiDMATransferStart(dummyDataTx, false, pReceiveData, true, rxSize);
+
+    return true;
+}
+</#if>
 
 //*******************************************************************************
 /*
@@ -278,6 +423,10 @@ bool WDRV_WINC_SPIOpen(void)
     SYS_DMA_DataWidthSetup(spiDcpt.cfg.txDMAChannel, SYS_DMA_WIDTH_8_BIT);
 
     memset(dummyDataTx, 0, sizeof(dummyDataTx));
+
+    spiDcpt.pfTransferCB = NULL;
+    SYS_DMA_ChannelCallbackRegister(spiDcpt.cfg.rxDMAChannel, spiDMAEventHandler, 0);
+    SYS_DMA_ChannelCallbackRegister(spiDcpt.cfg.txDMAChannel, spiDMATxEventHandler, 0);
 <#else>
 <#if drv_spi?? && DRV_WIFI_WINC_SPI_INST_IDX gte 0>
     DRV_SPI_TRANSFER_SETUP spiTransConf = {
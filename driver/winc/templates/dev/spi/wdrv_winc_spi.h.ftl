@@ -51,6 +51,36 @@ typedef bool (*WDRV_WINC_SPI_PLIB_WRITE_READ)(void*, size_t, void *, size_t);
 typedef void (*WDRV_WINC_SPI_PLIB_CALLBACK_REGISTER)(SERCOM_SPI_CALLBACK, uintptr_t);
 
 </#if>
+</#if>
+<#if DRV_WIFI_WINC_TX_RX_DMA == true>
+#define WDRV_WINC_SPI_ASYNC_TRANSFER
+
+// *****************************************************************************
+/*  SPI Transfer Complete Callback
+
+  Summary:
+    Callback to notify the completion of an asynchronous SPI transfer.
+
+  Description:
+    Called from the DMA interrupt context when a transfer started with
+    WDRV_WINC_SPISendAsync or WDRV_WINC_SPIReceiveAsync has completed or
+    failed.
+
+  Parameters:
+    context - Context value supplied when the transfer was started.
+    success - true if the transfer completed, false if the DMA reported an
+              error.
+
+  Returns:
+    None.
+
+  Remarks:
+    The callback may start the next asynchronous transfer.
+
+*/
+
+typedef void (*WDRV_WINC_SPI_TRANSFER_CALLBACK)(uintptr_t context, bool success);
+
 </#if>
 // *****************************************************************************
 /*  SPI Speed Modes
@@ -179,6 +209,96 @@ bool WDRV_WINC_SPISend(void* pTransmitData, size_t txSize);
  */
 
 bool WDRV_WINC_SPIReceive(void* pReceiveData, size_t rxSize);
+<#if DRV_WIFI_WINC_TX_RX_DMA == true>
+
+//*******************************************************************************
+/*
+  Function:
+    bool WDRV_WINC_SPISendAsync
+    (
+        void* pTransmitData,
+        size_t txSize,
+        WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+        uintptr_t context
+    )
+
+  Summary:
+    Starts sending data out to the module through the SPI bus.
+
+  Description:
+    This function starts a DMA transfer sending data out to the module through
+    the SPI bus and returns immediately. The callback is called once the
+    transfer has completed or failed.
+
+  Precondition:
+    WDRV_WINC_SPIOpen must have been called.
+
+  Parameters:
+    pTransmitData - buffer pointer of output data
+    txSize        - the output data size
+    pfTransferCB  - transfer complete callback
+    context       - context value passed to the callback
+
+  Returns:
+    true  - Indicates success
+    false - Indicates failure
+
+  Remarks:
+    The buffer must remain valid until the callback has been called.
+ */
+
+bool WDRV_WINC_SPISendAsync
+(
+    void* pTransmitData,
+    size_t txSize,
+    WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+    uintptr_t context
+);
+
+//*******************************************************************************
+/*
+  Function:
+    bool WDRV_WINC_SPIReceiveAsync
+    (
+        void* pReceiveData,
+        size_t rxSize,
+        WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+        uintptr_t context
+    )
+
+  Summary:
+    Starts receiving data from the module through the SPI bus.
+
+  Description:
+    This function starts a DMA transfer receiving data from the module through
+    the SPI bus and returns immediately. The callback is called once the
+    transfer has completed or failed.
+
+  Precondition:
+    WDRV_WINC_SPIOpen must have been called.
+
+  Parameters:
+    pReceiveData - buffer pointer of input data
+    rxSize       - the input data size
+    pfTransferCB - transfer complete callback
+    context      - context value passed to the callback
+
+  Returns:
+    true  - Indicates success
+    false - Indicates failure
+
+  Remarks:
+    The buffer must remain valid until the callback has been called.
+ */
+
+bool WDRV_WINC_SPIReceiveAsync
+(
+    void* pReceiveData,
+    size_t rxSize,
+    WDRV_WINC_SPI_TRANSFER_CALLBACK pfTransferCB,
+    uintptr_t context
+);
+</#if>
 
 //*******************************************************************************
 /*
@@ -42,6 +42,7 @@
             <#lt>#define WDRV_WINC_DEVICE_SCAN_STOP_ON_FIRST
             <#lt>#define WDRV_WINC_DEVICE_DEPRECATE_WEP
             <#lt>#define WDRV_WINC_DEVICE_OTA_SSL_OPTIONS
+            <#lt>#define WDRV_WINC_DEVICE_SOCKET_STATS
         </#if>
     </#if>
     <#if DRV_WIFI_WINC_DRIVER_MODE == "Socket Mode">
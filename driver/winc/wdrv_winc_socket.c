@@ -1100,3 +1100,138 @@ WDRV_WINC_STATUS WDRV_WINC_SocketRegisterResolverCallback
 
     return WDRV_WINC_STATUS_OK;
 }
+
+#if defined(CONF_WINC_SOCKET_STATS) && defined(WDRV_WINC_DEVICE_SOCKET_STATS) && !defined(WDRV_WINC_DEVICE_LITE_DRIVER)
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SocketStatsGet
+    (
+        DRV_HANDLE handle,
+        SOCKET sock,
+        tstrSockStats *pStats
+    )
+
+  Summary:
+    Retrieve socket statistics counters.
+
+  Description:
+    Copies the counters for a single socket or all sockets.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SocketStatsGet
+(
+    DRV_HANDLE handle,
+    SOCKET sock,
+    tstrSockStats *pStats
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pStats))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    if (SOCK_ERR_NO_ERROR != get_socket_stats(sock, pStats))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_HIFStatsGet
+    (
+        DRV_HANDLE handle,
+        tstrHifStats *pStats
+    )
+
+  Summary:
+    Retrieve host interface statistics counters.
+
+  Description:
+    Copies the HIF counters.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_HIFStatsGet
+(
+    DRV_HANDLE handle,
+    tstrHifStats *pStats
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pStats))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    hif_get_stats(pStats);
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_StatsReset(DRV_HANDLE handle)
+
+  Summary:
+    Reset all socket and HIF statistics counters.
+
+  Description:
+    Clears the socket and HIF counters.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_StatsReset(DRV_HANDLE handle)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+
+    /* Ensure the driver handle is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    reset_socket_stats();
+    hif_reset_stats();
+
+    return WDRV_WINC_STATUS_OK;
+}
+#endif
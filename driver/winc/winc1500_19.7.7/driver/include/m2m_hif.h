@@ -53,6 +53,14 @@ MACROS
 
 #define M2M_HIF_HDR_OFFSET (sizeof(tstrHifHdr) + 4)
 
+#ifndef M2M_HIF_RX_PREFETCH_SIZE
+#define M2M_HIF_RX_PREFETCH_SIZE     (32)
+#endif
+/*!< Number of payload bytes read together with the HIF header of a received packet.
+     Requests from the group callbacks which fall within this range are served from
+     the prefetched copy instead of issuing another bus transaction. Set to 0 to disable.
+*/
+
 /**
 *   @struct     tstrHifHdr
 *   @brief      Structure to hold HIF header
@@ -64,6 +72,32 @@ typedef struct
     uint16_t  u16Length;    /*!< Payload length */
 }tstrHifHdr;
 
+/**
+*   @struct     tstrHifDataSeg
+*   @brief      Structure describing one segment of a gathered HIF data packet
+*/
+typedef struct
+{
+    uint8_t   *pu8Buf;      /*!< Pointer to the segment data */
+    uint16_t  u16Size;      /*!< Segment size in bytes */
+}tstrHifDataSeg;
+
+/**
+*   @struct     tstrHifStats
+*   @brief      Structure to hold HIF statistics, collected when CONF_WINC_SOCKET_STATS is defined
+*/
+typedef struct
+{
+    uint32_t  u32Sends;         /*!< Number of hif_send requests */
+    uint32_t  u32SendFails;     /*!< Number of hif_send requests which failed */
+    uint32_t  u32ChipWakes;     /*!< Number of times the chip was woken from sleep */
+    uint32_t  u32DmaAddrPolls;  /*!< Total number of DMA address polling iterations in hif_send */
+    uint32_t  u32DmaAddrPollsMax; /*!< Largest number of DMA address polling iterations in a single hif_send */
+    uint32_t  u32RxPackets;     /*!< Number of packets received from the firmware */
+    uint32_t  u32RxPrefetchHits; /*!< Number of hif_receive requests served from the prefetched header read */
+    uint32_t  u32RxBusReads;    /*!< Number of bus transactions issued while receiving packets */
+}tstrHifStats;
+
 #ifdef __cplusplus
      extern "C" {
 #endif
@@ -125,6 +159,29 @@ int8_t hif_deinit(void * arg);
 int8_t hif_send(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16CtrlBufSize,
                        uint8_t *pu8DataBuf,uint16_t u16DataSize, uint16_t u16DataOffset);
 /**
+*   @fn     int8_t hif_send_vec(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16CtrlBufSize,
+                       const tstrHifDataSeg *pstrSegs,uint8_t u8NumSegs, uint16_t u16DataOffset)
+*   @brief  Send packet using host interface, gathering the packet data from a list of segments.
+
+*   @param [in] u8Gid
+*               Group ID.
+*   @param [in] u8Opcode
+*               Operation ID.
+*   @param [in] pu8CtrlBuf
+*               Pointer to the Control buffer.
+*   @param [in] u16CtrlBufSize
+                Control buffer size.
+*   @param [in] pstrSegs
+*               List of data segments, written to the packet back to back in order.
+*   @param [in] u8NumSegs
+                Number of data segments, if ZERO the packet carries no data.
+*   @param [in] u16DataOffset
+                Packet Data offset.
+*    @return    The function shall return ZERO for successful operation and a negative value otherwise.
+*/
+int8_t hif_send_vec(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16CtrlBufSize,
+                       const tstrHifDataSeg *pstrSegs,uint8_t u8NumSegs, uint16_t u16DataOffset);
+/**
 *   @fn     hif_receive
 *   @brief  Host interface interrupt service routine
 *   @param [in] u32Addr
@@ -216,6 +273,24 @@ uint8_t hif_get_sleep_mode(void);
 */
 int8_t hif_handle_isr(void);
 
+#ifdef CONF_WINC_SOCKET_STATS
+/**
+*   @fn     hif_get_stats(tstrHifStats *pstrStats)
+*   @brief
+            Get the HIF statistics.
+*   @param [out] pstrStats
+            Pointer to structure to be populated with the statistics.
+*/
+void hif_get_stats(tstrHifStats *pstrStats);
+
+/**
+*   @fn     hif_reset_stats(void)
+*   @brief
+            Clear the HIF statistics.
+*/
+void hif_reset_stats(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,8 +59,12 @@ typedef struct {
     uint8_t u8ChipSleep;
     uint8_t u8HifRXDone;
     uint8_t u8Interrupt;
+    uint8_t u8RxCtrlValid;
     uint32_t u32RxAddr;
     uint32_t u32RxSize;
+    uint32_t u32RxCtrl;
+    uint16_t u16RxPrefetchSize;
+    uint8_t au8RxPrefetch[M2M_HIF_HDR_OFFSET + M2M_HIF_RX_PREFETCH_SIZE];
     tpfHifCallBack pfWifiCb;
     tpfHifCallBack pfIpCb;
     tpfHifCallBack pfOtaCb;
@@ -72,14 +76,31 @@ typedef struct {
 
 volatile tstrHifContext gstrHifCxt;
 
+#ifdef CONF_WINC_SOCKET_STATS
+static tstrHifStats gstrHifStats;
+#define HIF_STATS_ADD(field, val)   (gstrHifStats.field += (val))
+#else
+#define HIF_STATS_ADD(field, val)
+#endif
+
 static int8_t hif_set_rx_done(void)
 {
     uint32_t reg;
     int8_t ret = M2M_SUCCESS;
 
     gstrHifCxt.u8HifRXDone = 0;
-    ret = nm_read_reg_with_ret(WIFI_HOST_RCV_CTRL_0,&reg);
-    if(ret != M2M_SUCCESS)goto ERR1;
+    if(gstrHifCxt.u8RxCtrlValid)
+    {
+        /* The firmware does not touch the register until RX done is set, so
+         * the value written by hif_isr when clearing the interrupt is reused. */
+        gstrHifCxt.u8RxCtrlValid = 0;
+        reg = gstrHifCxt.u32RxCtrl;
+    }
+    else
+    {
+        ret = nm_read_reg_with_ret(WIFI_HOST_RCV_CTRL_0,&reg);
+        if(ret != M2M_SUCCESS)goto ERR1;
+    }
     /* Set RX Done */
     reg |= NBIT1;
     ret = nm_write_reg(WIFI_HOST_RCV_CTRL_0,reg);
@@ -121,6 +142,9 @@ int8_t hif_chip_wake(void)
     {
         if(gstrHifCxt.u8ChipMode != M2M_NO_PS)
         {
+#ifdef CONF_WINC_SOCKET_STATS
+            gstrHifStats.u32ChipWakes++;
+#endif
             ret = chip_wake();
             if(ret != M2M_SUCCESS)goto ERR1;
         }
@@ -265,26 +289,59 @@ int8_t hif_deinit(void * arg)
 
 int8_t hif_send(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16CtrlBufSize,
                uint8_t *pu8DataBuf,uint16_t u16DataSize, uint16_t u16DataOffset)
+{
+    tstrHifDataSeg strSeg;
+
+    strSeg.pu8Buf   = pu8DataBuf;
+    strSeg.u16Size  = u16DataSize;
+
+    return hif_send_vec(u8Gid, u8Opcode, pu8CtrlBuf, u16CtrlBufSize,
+                        &strSeg, (pu8DataBuf != NULL) ? 1 : 0, u16DataOffset);
+}
+/**
+*   @fn     int8_t hif_send_vec(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16CtrlBufSize,
+                       const tstrHifDataSeg *pstrSegs,uint8_t u8NumSegs, uint16_t u16DataOffset)
+*   @brief  Send packet using host interface, gathering the packet data from a list of segments.
+*   @return The function shall return ZERO for successful operation and a negative value otherwise.
+*/
+int8_t hif_send_vec(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16CtrlBufSize,
+               const tstrHifDataSeg *pstrSegs,uint8_t u8NumSegs, uint16_t u16DataOffset)
 {
     int8_t     ret = M2M_ERR_SEND;
     tstrHifHdr strHif;
+    uint32_t   u32Length;
+    uint8_t    u8Seg;
+
+    if((pstrSegs == NULL) && (u8NumSegs != 0))
+    {
+        return M2M_ERR_INVALID_ARG;
+    }
 
     while (OSAL_RESULT_FALSE == OSAL_SEM_Pend(&hifSemaphore, OSAL_WAIT_FOREVER))
     {
     }
 
+#ifdef CONF_WINC_SOCKET_STATS
+    gstrHifStats.u32Sends++;
+#endif
+
     strHif.u8Opcode     = u8Opcode&(~NBIT7);
     strHif.u8Gid        = u8Gid;
-    strHif.u16Length    = M2M_HIF_HDR_OFFSET;
-    if(pu8DataBuf != NULL)
+    u32Length           = M2M_HIF_HDR_OFFSET;
+    if(u8NumSegs != 0)
     {
-        strHif.u16Length += u16DataOffset + u16DataSize;
+        u32Length += u16DataOffset;
+        for(u8Seg = 0; u8Seg < u8NumSegs; u8Seg++)
+        {
+            u32Length += pstrSegs[u8Seg].u16Size;
+        }
     }
     else
     {
-        strHif.u16Length += u16CtrlBufSize;
+        u32Length += u16CtrlBufSize;
     }
-    if (strHif.u16Length <= M2M_HIF_MAX_PACKET_SIZE)
+    strHif.u16Length    = (uint16_t)u32Length;
+    if (u32Length <= M2M_HIF_MAX_PACKET_SIZE)
     {
     ret = hif_chip_wake();
         if(ret == M2M_SUCCESS)
@@ -332,6 +389,11 @@ int8_t hif_send(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16C
                     break;
                 }
             }
+#ifdef CONF_WINC_SOCKET_STATS
+            gstrHifStats.u32DmaAddrPolls += cnt + 1;
+            if((uint32_t)cnt + 1 > gstrHifStats.u32DmaAddrPollsMax)
+                gstrHifStats.u32DmaAddrPollsMax = cnt + 1;
+#endif
 
             if (dma_addr != 0)
             {
@@ -347,12 +409,17 @@ int8_t hif_send(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16C
                     if(M2M_SUCCESS != ret) goto ERR1;
                     u32CurrAddr += u16CtrlBufSize;
                 }
-                if(pu8DataBuf != NULL)
+                if(u8NumSegs != 0)
                 {
                     u32CurrAddr += (u16DataOffset - u16CtrlBufSize);
-                    ret = nm_write_block(u32CurrAddr, pu8DataBuf, u16DataSize);
-                    if(M2M_SUCCESS != ret) goto ERR1;
-                    u32CurrAddr += u16DataSize;
+                    for(u8Seg = 0; u8Seg < u8NumSegs; u8Seg++)
+                    {
+                        if(pstrSegs[u8Seg].u16Size == 0)
+                            continue;
+                        ret = nm_write_block(u32CurrAddr, pstrSegs[u8Seg].pu8Buf, pstrSegs[u8Seg].u16Size);
+                        if(M2M_SUCCESS != ret) goto ERR1;
+                        u32CurrAddr += pstrSegs[u8Seg].u16Size;
+                    }
                 }
 
                 reg = dma_addr << 2;
@@ -377,7 +444,7 @@ int8_t hif_send(uint8_t u8Gid,uint8_t u8Opcode,uint8_t *pu8CtrlBuf,uint16_t u16C
     }
     else
     {
-        M2M_ERR("HIF message length (%d) exceeds max length (%d)\r\n",strHif.u16Length, M2M_HIF_MAX_PACKET_SIZE);
+        M2M_ERR("HIF message length (%lu) exceeds max length (%d)\r\n",(unsigned long)u32Length, M2M_HIF_MAX_PACKET_SIZE);
         ret = M2M_ERR_SEND;
         goto ERR2;
     }
@@ -389,6 +456,9 @@ ERR1:
     /*reset the count but no actual sleep as it already bus error*/
     hif_chip_sleep_sc();
 ERR2:
+#ifdef CONF_WINC_SOCKET_STATS
+    gstrHifStats.u32SendFails++;
+#endif
     OSAL_SEM_Post(&hifSemaphore);
     /*logical error*/
     return ret;
@@ -423,9 +493,12 @@ static int8_t hif_isr(void)
             ret = nm_write_reg(WIFI_HOST_RCV_CTRL_0,reg);
             if(ret != M2M_SUCCESS)goto ERR1;
             gstrHifCxt.u8HifRXDone = 1;
+            gstrHifCxt.u32RxCtrl = reg;
+            gstrHifCxt.u8RxCtrlValid = 1;
             size = (uint16_t)((reg >> 2) & 0xfff);
             if (size > 0) {
                 uint32_t address = 0;
+                uint16_t u16ReadSz;
                 /**
                 start bus transfer
                 **/
@@ -437,13 +510,26 @@ static int8_t hif_isr(void)
                 }
                 gstrHifCxt.u32RxAddr = address;
                 gstrHifCxt.u32RxSize = size;
-                ret = nm_read_block(address, (uint8_t*)&strHif, sizeof(tstrHifHdr));
-                strHif.u16Length = NM_BSP_B_L_16(strHif.u16Length);
+
+                /* Read the header together with the start of the payload,
+                 * which is usually all the group callback asks for. */
+                u16ReadSz = size;
+                if(u16ReadSz > sizeof(gstrHifCxt.au8RxPrefetch))
+                    u16ReadSz = sizeof(gstrHifCxt.au8RxPrefetch);
+                if(u16ReadSz < sizeof(tstrHifHdr))
+                    u16ReadSz = sizeof(tstrHifHdr);
+                gstrHifCxt.u16RxPrefetchSize = 0;
+                ret = nm_read_block(address, (uint8_t*)gstrHifCxt.au8RxPrefetch, u16ReadSz);
+                HIF_STATS_ADD(u32RxPackets, 1);
+                HIF_STATS_ADD(u32RxBusReads, 1);
                 if(M2M_SUCCESS != ret)
                 {
                     M2M_ERR("(hif) address bus fail\r\n");
                     goto ERR1;
                 }
+                gstrHifCxt.u16RxPrefetchSize = u16ReadSz;
+                memcpy(&strHif, (uint8_t*)gstrHifCxt.au8RxPrefetch, sizeof(tstrHifHdr));
+                strHif.u16Length = NM_BSP_B_L_16(strHif.u16Length);
                 if(strHif.u16Length != size)
                 {
                     if((size - strHif.u16Length) > 4)
@@ -600,9 +686,18 @@ int8_t hif_receive(uint32_t u32Addr, uint8_t *pu8Buf, uint16_t u16Sz, uint8_t is
         goto ERR1;
     }
 
-    /* Receive the payload */
-    ret = nm_read_block(u32Addr, pu8Buf, u16Sz);
-    if(ret != M2M_SUCCESS)goto ERR1;
+    /* Receive the payload, from the prefetched copy if it covers the request */
+    if((u32Addr + u16Sz) <= (gstrHifCxt.u32RxAddr + gstrHifCxt.u16RxPrefetchSize))
+    {
+        memcpy(pu8Buf, (uint8_t*)&gstrHifCxt.au8RxPrefetch[u32Addr - gstrHifCxt.u32RxAddr], u16Sz);
+        HIF_STATS_ADD(u32RxPrefetchHits, 1);
+    }
+    else
+    {
+        ret = nm_read_block(u32Addr, pu8Buf, u16Sz);
+        HIF_STATS_ADD(u32RxBusReads, 1);
+        if(ret != M2M_SUCCESS)goto ERR1;
+    }
 
     /* check if this is the last packet */
     if((((gstrHifCxt.u32RxAddr + gstrHifCxt.u32RxSize) - (u32Addr + u16Sz)) <= 0) || isDone)
@@ -659,4 +754,29 @@ int8_t hif_register_cb(uint8_t u8Grp,tpfHifCallBack fn)
     return ret;
 }
 
+#ifdef CONF_WINC_SOCKET_STATS
+/**
+*   @fn     hif_get_stats
+*   @brief  Get the HIF statistics
+*   @param [out] pstrStats
+*               Pointer to structure to be populated with the statistics.
+*/
+void hif_get_stats(tstrHifStats *pstrStats)
+{
+    if(pstrStats != NULL)
+    {
+        memcpy(pstrStats, &gstrHifStats, sizeof(tstrHifStats));
+    }
+}
+
+/**
+*   @fn     hif_reset_stats
+*   @brief  Clear the HIF statistics
+*/
+void hif_reset_stats(void)
+{
+    memset(&gstrHifStats, 0, sizeof(tstrHifStats));
+}
+#endif
+
 //DOM-IGNORE-END
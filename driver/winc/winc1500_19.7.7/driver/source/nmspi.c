@@ -90,10 +90,38 @@ Microchip or any third party.
 #define DATA_PKT_SZ_8K          (8 * 1024)
 #define DATA_PKT_SZ             DATA_PKT_SZ_8K
 
+#ifdef WDRV_WINC_SPI_ASYNC_TRANSFER
+/* Block transfers of at least this size run the data phase as a chain of DMA transfers. */
+#define SPI_ASYNC_MIN_SZ        64
+
+#define SPI_ASYNC_STATE_RSP     0
+#define SPI_ASYNC_STATE_CMD     1
+#define SPI_ASYNC_STATE_DATA    2
+#define SPI_ASYNC_STATE_CRC     3
+#endif
+
 static uint8_t gu8Crc_off = 0;
 
 static OSAL_MUTEX_HANDLE_TYPE s_spiLock;
 
+#ifdef WDRV_WINC_SPI_ASYNC_TRANSFER
+typedef struct
+{
+    uint8_t         *pu8Buf;
+    uint16_t        u16Remaining;
+    uint16_t        u16ChunkSz;
+    int16_t         s16Retry;
+    volatile int8_t s8Result;
+    uint8_t         u8State;
+    /* CRC of the previous packet followed by the command of the next packet. */
+    uint8_t         au8Hdr[3];
+} tstrSpiAsyncXfer;
+
+static tstrSpiAsyncXfer gstrSpiAsync;
+
+static OSAL_SEM_HANDLE_TYPE s_spiAsyncSem;
+#endif
+
 static inline int8_t spi_read(uint8_t *b, uint16_t sz)
 {
     if (true == WDRV_WINC_SPIReceive((unsigned char *const) b, sz))
@@ -541,6 +569,221 @@ static int8_t spi_data_write(uint8_t *b, uint16_t sz)
     return result;
 }
 
+#ifdef WDRV_WINC_SPI_ASYNC_TRANSFER
+/********************************************
+
+    Spi Asynchronous (DMA) Data Phase
+
+    The data phase of a block transfer is split into DATA_PKT_SZ packets,
+    each framed by a response or command byte and an optional CRC. Each
+    completion callback starts the next transfer of the frame sequence from
+    the DMA interrupt, so the calling task only blocks once per block while
+    the CPU is released for the duration of the transfer.
+
+********************************************/
+
+static void spi_async_complete(int8_t s8Result)
+{
+    gstrSpiAsync.s8Result = s8Result;
+    (void)OSAL_SEM_PostISR(&s_spiAsyncSem);
+}
+
+static void spi_async_read_cb(uintptr_t context, bool success)
+{
+    bool bStarted = false;
+
+    if (false == success)
+    {
+        spi_async_complete(N_FAIL);
+        return;
+    }
+
+    switch (gstrSpiAsync.u8State)
+    {
+        case SPI_ASYNC_STATE_RSP:
+        {
+            if ((gstrSpiAsync.au8Hdr[0] & 0xf0) == 0xf0)
+            {
+                gstrSpiAsync.u16ChunkSz = (gstrSpiAsync.u16Remaining <= DATA_PKT_SZ) ? gstrSpiAsync.u16Remaining : DATA_PKT_SZ;
+                gstrSpiAsync.u8State    = SPI_ASYNC_STATE_DATA;
+
+                bStarted = WDRV_WINC_SPIReceiveAsync(gstrSpiAsync.pu8Buf, gstrSpiAsync.u16ChunkSz, spi_async_read_cb, 0);
+            }
+            else if (gstrSpiAsync.s16Retry-- > 0)
+            {
+                bStarted = WDRV_WINC_SPIReceiveAsync(&gstrSpiAsync.au8Hdr[0], 1, spi_async_read_cb, 0);
+            }
+            break;
+        }
+
+        case SPI_ASYNC_STATE_DATA:
+        {
+            gstrSpiAsync.pu8Buf       += gstrSpiAsync.u16ChunkSz;
+            gstrSpiAsync.u16Remaining -= gstrSpiAsync.u16ChunkSz;
+
+            if (gu8Crc_off == 0)
+            {
+                gstrSpiAsync.u8State = SPI_ASYNC_STATE_CRC;
+
+                bStarted = WDRV_WINC_SPIReceiveAsync(&gstrSpiAsync.au8Hdr[0], 2, spi_async_read_cb, 0);
+                break;
+            }
+        }
+        /* fall through */
+
+        case SPI_ASYNC_STATE_CRC:
+        {
+            if (0 == gstrSpiAsync.u16Remaining)
+            {
+                spi_async_complete(N_OK);
+                return;
+            }
+
+            gstrSpiAsync.u8State  = SPI_ASYNC_STATE_RSP;
+            gstrSpiAsync.s16Retry = SPI_RESP_RETRY_COUNT;
+
+            bStarted = WDRV_WINC_SPIReceiveAsync(&gstrSpiAsync.au8Hdr[0], 1, spi_async_read_cb, 0);
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if (false == bStarted)
+    {
+        spi_async_complete(N_FAIL);
+    }
+}
+
+static int8_t spi_data_read_async(uint8_t *b, uint16_t sz)
+{
+    gstrSpiAsync.pu8Buf       = b;
+    gstrSpiAsync.u16Remaining = sz;
+    gstrSpiAsync.s16Retry     = SPI_RESP_RETRY_COUNT;
+    gstrSpiAsync.u8State      = SPI_ASYNC_STATE_RSP;
+
+    if (false == WDRV_WINC_SPIReceiveAsync(&gstrSpiAsync.au8Hdr[0], 1, spi_async_read_cb, 0))
+    {
+        M2M_ERR("[spi_data_read_async]: Failed data response read, bus error...\r\n");
+        return N_FAIL;
+    }
+
+    while (OSAL_RESULT_FALSE == OSAL_SEM_Pend(&s_spiAsyncSem, OSAL_WAIT_FOREVER))
+    {
+    }
+
+    if (N_OK != gstrSpiAsync.s8Result)
+    {
+        M2M_ERR("[spi_data_read_async]: Failed data read, %d bytes remaining...\r\n", gstrSpiAsync.u16Remaining);
+    }
+
+    return gstrSpiAsync.s8Result;
+}
+
+static void spi_async_write_cb(uintptr_t context, bool success)
+{
+    bool bStarted = false;
+
+    if (false == success)
+    {
+        spi_async_complete(N_FAIL);
+        return;
+    }
+
+    switch (gstrSpiAsync.u8State)
+    {
+        case SPI_ASYNC_STATE_CMD:
+        {
+            gstrSpiAsync.u8State = SPI_ASYNC_STATE_DATA;
+
+            bStarted = WDRV_WINC_SPISendAsync(gstrSpiAsync.pu8Buf, gstrSpiAsync.u16ChunkSz, spi_async_write_cb, 0);
+            break;
+        }
+
+        case SPI_ASYNC_STATE_DATA:
+        {
+            uint8_t u8HdrLen = 0;
+
+            gstrSpiAsync.pu8Buf       += gstrSpiAsync.u16ChunkSz;
+            gstrSpiAsync.u16Remaining -= gstrSpiAsync.u16ChunkSz;
+
+            if (gu8Crc_off == 0)
+            {
+                gstrSpiAsync.au8Hdr[0] = 0;
+                gstrSpiAsync.au8Hdr[1] = 0;
+                u8HdrLen = 2;
+            }
+
+            if (0 == gstrSpiAsync.u16Remaining)
+            {
+                if (0 == u8HdrLen)
+                {
+                    spi_async_complete(N_OK);
+                    return;
+                }
+
+                gstrSpiAsync.u8State = SPI_ASYNC_STATE_CRC;
+            }
+            else
+            {
+                /* Send the CRC of this packet and the command of the next in one transfer. */
+                gstrSpiAsync.u16ChunkSz = (gstrSpiAsync.u16Remaining <= DATA_PKT_SZ) ? gstrSpiAsync.u16Remaining : DATA_PKT_SZ;
+                gstrSpiAsync.au8Hdr[u8HdrLen++] = 0xf0 | ((gstrSpiAsync.u16Remaining <= DATA_PKT_SZ) ? 0x3 : 0x2);
+                gstrSpiAsync.u8State = SPI_ASYNC_STATE_CMD;
+            }
+
+            bStarted = WDRV_WINC_SPISendAsync(&gstrSpiAsync.au8Hdr[0], u8HdrLen, spi_async_write_cb, 0);
+            break;
+        }
+
+        case SPI_ASYNC_STATE_CRC:
+        {
+            spi_async_complete(N_OK);
+            return;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if (false == bStarted)
+    {
+        spi_async_complete(N_FAIL);
+    }
+}
+
+static int8_t spi_data_write_async(uint8_t *b, uint16_t sz)
+{
+    gstrSpiAsync.pu8Buf       = b;
+    gstrSpiAsync.u16Remaining = sz;
+    gstrSpiAsync.u16ChunkSz   = (sz <= DATA_PKT_SZ) ? sz : DATA_PKT_SZ;
+    gstrSpiAsync.au8Hdr[0]    = 0xf0 | ((sz <= DATA_PKT_SZ) ? 0x3 : 0x1);
+    gstrSpiAsync.u8State      = SPI_ASYNC_STATE_CMD;
+
+    if (false == WDRV_WINC_SPISendAsync(&gstrSpiAsync.au8Hdr[0], 1, spi_async_write_cb, 0))
+    {
+        M2M_ERR("[spi_data_write_async]: Failed data block cmd write, bus error...\r\n");
+        return N_FAIL;
+    }
+
+    while (OSAL_RESULT_FALSE == OSAL_SEM_Pend(&s_spiAsyncSem, OSAL_WAIT_FOREVER))
+    {
+    }
+
+    if (N_OK != gstrSpiAsync.s8Result)
+    {
+        M2M_ERR("[spi_data_write_async]: Failed data block write, %d bytes remaining...\r\n", gstrSpiAsync.u16Remaining);
+    }
+
+    return gstrSpiAsync.s8Result;
+}
+
+#endif
 /********************************************
 
     Spi interfaces
@@ -585,6 +828,7 @@ static int8_t spi_write_block(uint32_t u32Addr, uint8_t *puBuf, uint16_t u16Sz)
 {
     uint8_t len;
     uint8_t rsp[3];
+    int8_t result;
 
     /**
         Command
@@ -604,7 +848,18 @@ static int8_t spi_write_block(uint32_t u32Addr, uint8_t *puBuf, uint16_t u16Sz)
     /**
         Data
     **/
-    if (spi_data_write(puBuf, u16Sz) != N_OK)
+#ifdef WDRV_WINC_SPI_ASYNC_TRANSFER
+    if (u16Sz >= SPI_ASYNC_MIN_SZ)
+    {
+        result = spi_data_write_async(puBuf, u16Sz);
+    }
+    else
+#endif
+    {
+        result = spi_data_write(puBuf, u16Sz);
+    }
+
+    if (result != N_OK)
     {
         M2M_ERR("[spi_write_block]: Failed block data write...\r\n");
         return N_FAIL;
@@ -680,6 +935,8 @@ static int8_t spi_read_reg(uint32_t u32Addr, uint32_t* pu32RetVal)
 
 static int8_t spi_read_block(uint32_t u32Addr, uint8_t *puBuf, uint16_t u16Sz)
 {
+    int8_t result;
+
     /**
         Command
     **/
@@ -698,7 +955,18 @@ static int8_t spi_read_block(uint32_t u32Addr, uint8_t *puBuf, uint16_t u16Sz)
     /**
         Data
     **/
-    if (spi_data_read(puBuf, u16Sz, 0) != N_OK)
+#ifdef WDRV_WINC_SPI_ASYNC_TRANSFER
+    if (u16Sz >= SPI_ASYNC_MIN_SZ)
+    {
+        result = spi_data_read_async(puBuf, u16Sz);
+    }
+    else
+#endif
+    {
+        result = spi_data_read(puBuf, u16Sz, 0);
+    }
+
+    if (result != N_OK)
     {
         M2M_ERR("[spi_read_block]: Failed block data read...\r\n");
         return N_FAIL;
@@ -751,6 +1019,9 @@ int8_t nm_spi_reset(void)
 void nm_spi_lock_init(void)
 {
     OSAL_MUTEX_Create(&s_spiLock);
+#ifdef WDRV_WINC_SPI_ASYNC_TRANSFER
+    OSAL_SEM_Create(&s_spiAsyncSem, OSAL_SEM_TYPE_BINARY, 1, 0);
+#endif
 }
 
 /*
@@ -829,6 +1100,9 @@ int8_t nm_spi_deinit(void)
 {
     gu8Crc_off = 0;
     OSAL_MUTEX_Delete(&s_spiLock);
+#ifdef WDRV_WINC_SPI_ASYNC_TRANSFER
+    OSAL_SEM_Delete(&s_spiAsyncSem);
+#endif
     return M2M_SUCCESS;
 }
 
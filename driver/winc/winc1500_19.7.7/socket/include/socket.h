@@ -143,6 +143,34 @@ MACROS
     Maximum number of simultaneous sockets.
 */
 
+#ifndef SOCKET_RX_BUFFER_QUEUE_DEPTH
+#define SOCKET_RX_BUFFER_QUEUE_DEPTH                        1
+#endif
+/*!<
+    Maximum number of receive buffers which can be posted to a socket ahead of
+    the data arriving, by calling @ref recv or @ref recvfrom repeatedly.\n
+    Buffers are filled in the order they were posted. For TCP sockets the data of
+    a single firmware receive event may be spread over several posted buffers, in
+    which case one @ref SOCKET_MSG_RECV event is delivered per buffer.\n
+    While buffers remain posted the next receive request is issued to the firmware
+    before the application callback is called, so data flow does not depend on the
+    application calling @ref recv from within the callback.
+*/
+
+#ifndef SOCKET_SEND_MAX_SEGMENTS
+#define SOCKET_SEND_MAX_SEGMENTS                            4
+#endif
+/*!<
+    Maximum number of data segments which can be passed to a single call of
+    @ref sendv or @ref sendtov.
+*/
+
+#define SOCKET_STATS_ALL                                    (-1)
+/*!<
+    Socket ID value used with @ref get_socket_stats to retrieve the combined
+    statistics of all sockets.
+*/
+
 #define SOL_SOCKET                                          1
 /*!<
     Socket option.
@@ -679,6 +707,77 @@ typedef struct {
         https://www.iana.org/assignments/tls-parameters/tls-parameters.xhtml#tls-parameters-6.
     */
 } tstrSockErr;
+
+/*!
+@struct \
+    tstrSockStats
+
+@brief
+    Socket traffic statistics. Used with @ref get_socket_stats.
+    Only collected when CONF_WINC_SOCKET_STATS is defined.
+*/
+typedef struct {
+    uint32_t    u32BytesIn;
+    /*!<
+        Number of application data bytes delivered to the application.
+    */
+    uint32_t    u32BytesOut;
+    /*!<
+        Number of application data bytes passed to the firmware for sending.
+    */
+    uint32_t    u32MsgsIn;
+    /*!<
+        Number of @ref SOCKET_MSG_RECV and @ref SOCKET_MSG_RECVFROM events carrying data.
+    */
+    uint32_t    u32MsgsOut;
+    /*!<
+        Number of send and sendto requests accepted by the firmware.
+    */
+    uint32_t    u32HifSends;
+    /*!<
+        Number of HIF send and receive requests issued.
+    */
+    uint32_t    u32HifSendFails;
+    /*!<
+        Number of HIF requests which failed, for example due to lack of firmware buffers.
+    */
+    uint32_t    u32RecvUnderruns;
+    /*!<
+        Number of times data arrived from the firmware with no receive buffer posted.
+    */
+    uint32_t    u32CbCount;
+    /*!<
+        Number of application socket callbacks.
+    */
+    uint32_t    u32CbLatencyTotal;
+    /*!<
+        Total latency from a socket event being received from the firmware to the application
+        socket callback being called, in SYS_TIME counter ticks.
+    */
+    uint32_t    u32CbLatencyMax;
+    /*!<
+        Longest latency from a socket event being received from the firmware to the application
+        socket callback being called, in SYS_TIME counter ticks.
+    */
+} tstrSockStats;
+
+/*!
+@struct \
+    tstrSockSendSeg
+
+@brief
+    One segment of data to be transmitted by @ref sendv or @ref sendtov.
+*/
+typedef struct {
+    void        *pvBuffer;
+    /*!<
+        Pointer to the segment data.
+    */
+    uint16_t    u16Length;
+    /*!<
+        Segment length in bytes.
+    */
+} tstrSockSendSeg;
 /**@}*/     //SocketEnums
 
 /**@defgroup  AsyncCallback Asynchronous Events
@@ -849,7 +948,9 @@ typedef struct {
     A negative or zero buffer size indicates an error with the following code:
     @ref SOCK_ERR_NO_ERROR          : Socket connection closed. The application should now call @ref close().
     @ref SOCK_ERR_CONN_ABORTED      : Socket connection aborted. The application should now call @ref close().
-    @ref SOCK_ERR_TIMEOUT           : Socket receive timed out. The socket connection remains open.
+    @ref SOCK_ERR_TIMEOUT           : Socket receive timed out. The socket connection remains open.\n
+    In the case of an error, pu8Buffer is the posted buffer which the failed receive request has returned
+    to the application, which may be NULL if no buffer was posted.
 */
 typedef struct {
     uint8_t                 *pu8Buffer;
@@ -1651,6 +1752,10 @@ int8_t secure(SOCKET sock);
                 Timeout for the recv function in milli-seconds. If the value is set to ZERO, the timeout
                 will be set to infinite (the recv function waits forever). If the timeout period is
                 elapsed with no data received, the socket will get a timeout error.
+
+@note
+    Up to @ref SOCKET_RX_BUFFER_QUEUE_DEPTH buffers may be posted to a socket by calling recv
+    several times. If the queue is already full the most recently posted buffer is replaced.
 @pre
     - The socket function must be called to allocate a TCP socket before passing the socket ID to the recv function.
     - The socket in a connected state is expected to receive data through the socket interface.
@@ -1958,6 +2063,85 @@ int16_t send(SOCKET sock, void *pvSendBuffer, uint16_t u16SendLength, uint16_t u
 int16_t sendto(SOCKET sock, void *pvSendBuffer, uint16_t u16SendLength, uint16_t flags, struct sockaddr *pstrDestAddr, uint8_t u8AddrLen);
 /**@}*/     //SendToSocketFn
 
+/** @defgroup SendVSocketFn sendv
+ *  @ingroup SocketAPI
+*    Asynchronous gathering send function, used to send data held in several separate buffers on a TCP or UDP socket.
+*    The segments are written directly to the firmware packet buffer in order, so protocol headers and payload do
+*    not need to be copied into a single staging buffer first.
+*    After the data is sent, the socket callback function registered using registerSocketCallback(), is expected to receive
+*    the same event as for @ref send.
+*/
+/**@{*/
+/*!
+@fn \
+    int16_t sendv(SOCKET sock, const tstrSockSendSeg *pstrSegs, uint8_t u8NumSegs, uint16_t u16Flags);
+
+@param[in]  sock
+                Socket ID, must hold a non negative value.
+                A negative value will return a socket error @ref SOCK_ERR_INVALID_ARG. Indicating that an invalid argument is passed in.
+
+@param[in]  pstrSegs
+                Array of data segments to be transmitted. Segments with a NULL buffer pointer are not allowed.
+
+@param[in]  u8NumSegs
+                Number of segments in the array, between 1 and @ref SOCKET_SEND_MAX_SEGMENTS.
+
+@param[in]  u16Flags
+                Not used in the current implementation.
+
+@pre
+    The same preconditions as @ref send apply.
+
+@warning
+    The total length of all segments must not exceed @ref SOCKET_BUFFER_MAX_LENGTH.
+
+@see
+    send
+    sendtov
+
+@return
+    The function shall return @ref SOCK_ERR_NO_ERROR for successful operation and a negative value (indicating the error) otherwise.
+*/
+int16_t sendv(SOCKET sock, const tstrSockSendSeg *pstrSegs, uint8_t u8NumSegs, uint16_t u16Flags);
+/*!
+@fn \
+    int16_t sendtov(SOCKET sock, const tstrSockSendSeg *pstrSegs, uint8_t u8NumSegs, uint16_t flags, struct sockaddr *pstrDestAddr, uint8_t u8AddrLen);
+
+@param[in]  sock
+                Socket ID, must hold a non negative value.
+                A negative value will return a socket error @ref SOCK_ERR_INVALID_ARG. Indicating that an invalid argument is passed in.
+
+@param[in]  pstrSegs
+                Array of data segments to be transmitted. Segments with a NULL buffer pointer are not allowed.
+
+@param[in]  u8NumSegs
+                Number of segments in the array, between 1 and @ref SOCKET_SEND_MAX_SEGMENTS.
+
+@param[in]  flags
+                Not used in the current implementation
+
+@param[in]  pstrDestAddr
+                The destination address.
+
+@param[in]  u8AddrLen
+                Destination address length in bytes.
+                Not used in the current implementation, only included for BSD compatibility.
+@pre
+    The same preconditions as @ref sendto apply.
+
+@warning
+    The total length of all segments must not exceed @ref SOCKET_BUFFER_MAX_LENGTH.
+
+@see
+    sendto
+    sendv
+
+@return
+    The function  returns @ref SOCK_ERR_NO_ERROR for successful operation and a negative value (indicating the error) otherwise.
+*/
+int16_t sendtov(SOCKET sock, const tstrSockSendSeg *pstrSegs, uint8_t u8NumSegs, uint16_t flags, struct sockaddr *pstrDestAddr, uint8_t u8AddrLen);
+/**@}*/     //SendVSocketFn
+
 /** @defgroup CloseSocketFn close
  *  @ingroup SocketAPI
  *  Synchronous close function, releases all the socket assigned resources.
@@ -2246,6 +2430,33 @@ int8_t get_alpn_index(SOCKET sock);
  *  has not been populated.
 */
 int8_t get_error_detail(SOCKET sock, tstrSockErr *pstrErr);
+
+#ifdef CONF_WINC_SOCKET_STATS
+/*!
+ *@fn   int8_t get_socket_stats(SOCKET sock, tstrSockStats *pstrStats);
+ *
+ *  This function gets the traffic statistics of a socket, or of all sockets combined.
+ *  Per socket statistics are cleared when the socket is created by @ref socket.
+
+ * @param[in]   sock
+ *                  Socket ID obtained by a call to @ref socket, or @ref SOCKET_STATS_ALL
+ *                  for the statistics of all sockets since initialization.
+ *
+ * @param[out]  pstrStats
+ *                  Pointer to structure to be populated with the statistics.
+ *
+ * @return  The function returns @ref SOCK_ERR_NO_ERROR if the request is successful
+ *  and a negative value otherwise.
+*/
+int8_t get_socket_stats(SOCKET sock, tstrSockStats *pstrStats);
+
+/*!
+ *@fn   void reset_socket_stats(void);
+ *
+ *  This function clears the statistics of all sockets.
+*/
+void reset_socket_stats(void);
+#endif
 /**@}*/     //PingFn
 
 #ifdef  __cplusplus
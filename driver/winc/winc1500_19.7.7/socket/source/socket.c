@@ -63,6 +63,9 @@ MACROS
 #define SOCKET_REQUEST(reqID, reqArgs, reqSize, reqPayload, reqPayloadSize, reqPayloadOffset)       \
     hif_send(M2M_REQ_GROUP_IP, reqID, reqArgs, reqSize, reqPayload, reqPayloadSize, reqPayloadOffset)
 
+#define SOCKET_REQUEST_VEC(reqID, reqArgs, reqSize, reqSegs, reqNumSegs, reqPayloadOffset)          \
+    hif_send_vec(M2M_REQ_GROUP_IP, reqID, reqArgs, reqSize, reqSegs, reqNumSegs, reqPayloadOffset)
+
 
 #define SSL_FLAGS_ACTIVE                    NBIT0
 #define SSL_FLAGS_BYPASS_X509               NBIT1
@@ -73,6 +76,16 @@ MACROS
 #define SSL_FLAGS_CHECK_SNI                 NBIT6
 #define SSL_FLAGS_DELAY                     NBIT7
 
+#ifdef CONF_WINC_SOCKET_STATS
+#define SOCKET_STATS_ADD(sock, field, val)      \
+    do {                                        \
+        gastrSockStats[sock].field += (val);    \
+        gstrSockStatsAll.field += (val);        \
+    } while(0)
+#else
+#define SOCKET_STATS_ADD(sock, field, val)
+#endif
+
 /*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
 PRIVATE DATA TYPES
 *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*/
@@ -92,8 +105,20 @@ typedef struct{
 *  @brief
 */
 typedef struct {
-    uint8_t             *pu8UserBuffer;
-    uint16_t            u16UserBufferSize;
+    uint8_t             *pu8Buffer;
+    uint16_t            u16BufferSize;
+} tstrSocketRecvBuf;
+
+
+/*!
+*  @brief
+*/
+typedef struct {
+    tstrSocketRecvBuf   astrRecvQueue[SOCKET_RX_BUFFER_QUEUE_DEPTH];
+    uint32_t            u32RecvTimeoutmsec;
+    uint8_t             u8RecvQueueHead;
+    uint8_t             u8RecvQueueCount;
+    uint8_t             u8RecvCmd;
     uint16_t            u16SessionID;
     uint16_t            u16DataOffset;
     uint8_t             bIsUsed;
@@ -121,6 +146,175 @@ volatile uint8_t                gbSocketInit = 0;
 static tpfPingCb                gfpPingCb = NULL;
 static uint32_t                 gu32PingId = 0;
 
+#ifdef CONF_WINC_SOCKET_STATS
+static tstrSockStats            gastrSockStats[MAX_SOCKET];
+static tstrSockStats            gstrSockStatsAll;
+static uint32_t                 gu32SockEventTime;
+#endif
+
+/*********************************************************************
+Function
+        Socket_AppCallback
+
+Description
+        Deliver a socket event to the application callback, recording
+        the latency from the event being received in m2m_ip_cb to the
+        callback being called.
+
+Return
+        None.
+*********************************************************************/
+static void Socket_AppCallback(SOCKET sock, uint8_t u8Msg, void *pvMsg)
+{
+#ifdef CONF_WINC_SOCKET_STATS
+    if((sock >= 0) && (sock < MAX_SOCKET))
+    {
+        uint32_t u32Latency = SYS_TIME_CounterGet() - gu32SockEventTime;
+
+        SOCKET_STATS_ADD(sock, u32CbCount, 1);
+        SOCKET_STATS_ADD(sock, u32CbLatencyTotal, u32Latency);
+
+        if(u32Latency > gastrSockStats[sock].u32CbLatencyMax)
+            gastrSockStats[sock].u32CbLatencyMax = u32Latency;
+        if(u32Latency > gstrSockStatsAll.u32CbLatencyMax)
+            gstrSockStatsAll.u32CbLatencyMax = u32Latency;
+    }
+#endif
+
+    if(gpfAppSocketCb)
+        gpfAppSocketCb(sock, u8Msg, pvMsg);
+}
+
+/*********************************************************************
+Function
+        Socket_RecvQueuePost
+
+Description
+        Post an application buffer to the socket receive queue. If the
+        queue is full the most recently posted buffer is replaced.
+
+Return
+        None.
+*********************************************************************/
+static void Socket_RecvQueuePost(SOCKET sock, uint8_t *pu8Buffer, uint16_t u16BufferSize)
+{
+    volatile tstrSocket *pstrSock = &gastrSockets[sock];
+    uint8_t             u8Idx;
+
+    if(pstrSock->u8RecvQueueCount < SOCKET_RX_BUFFER_QUEUE_DEPTH)
+    {
+        pstrSock->u8RecvQueueCount++;
+    }
+    u8Idx = (pstrSock->u8RecvQueueHead + pstrSock->u8RecvQueueCount - 1) % SOCKET_RX_BUFFER_QUEUE_DEPTH;
+
+    pstrSock->astrRecvQueue[u8Idx].pu8Buffer        = pu8Buffer;
+    pstrSock->astrRecvQueue[u8Idx].u16BufferSize    = u16BufferSize;
+}
+
+/*********************************************************************
+Function
+        Socket_RecvQueuePop
+
+Description
+        Remove the buffer at the head of the socket receive queue.
+
+Return
+        Pointer to the buffer removed, or NULL if the queue is empty.
+*********************************************************************/
+static uint8_t *Socket_RecvQueuePop(SOCKET sock)
+{
+    volatile tstrSocket         *pstrSock = &gastrSockets[sock];
+    volatile tstrSocketRecvBuf  *pstrBuf;
+    uint8_t                     *pu8Buffer;
+
+    if(pstrSock->u8RecvQueueCount == 0)
+        return NULL;
+
+    pstrBuf     = &pstrSock->astrRecvQueue[pstrSock->u8RecvQueueHead];
+    pu8Buffer   = pstrBuf->pu8Buffer;
+
+    pstrBuf->pu8Buffer      = NULL;
+    pstrBuf->u16BufferSize  = 0;
+    pstrSock->u8RecvQueueHead = (pstrSock->u8RecvQueueHead + 1) % SOCKET_RX_BUFFER_QUEUE_DEPTH;
+    pstrSock->u8RecvQueueCount--;
+
+    return pu8Buffer;
+}
+
+/*********************************************************************
+Function
+        Socket_RecvQueueSize
+
+Description
+        Returns the number of bytes the firmware may send in response to
+        the next receive request. Stream sockets can spread data over all
+        posted buffers, datagram sockets are limited to the first buffer.
+
+Return
+        Number of bytes.
+*********************************************************************/
+static uint16_t Socket_RecvQueueSize(SOCKET sock)
+{
+    volatile tstrSocket *pstrSock = &gastrSockets[sock];
+    uint32_t            u32Size = 0;
+    uint8_t             u8Count;
+
+    for(u8Count = 0; u8Count < pstrSock->u8RecvQueueCount; u8Count++)
+    {
+        u32Size += pstrSock->astrRecvQueue[(pstrSock->u8RecvQueueHead + u8Count) % SOCKET_RX_BUFFER_QUEUE_DEPTH].u16BufferSize;
+
+        if(sock >= TCP_SOCK_MAX)
+            break;
+    }
+
+    if(u32Size > SOCKET_BUFFER_MAX_LENGTH)
+    {
+        u32Size = SOCKET_BUFFER_MAX_LENGTH;
+        if(pstrSock->astrRecvQueue[pstrSock->u8RecvQueueHead].u16BufferSize > u32Size)
+            u32Size = pstrSock->astrRecvQueue[pstrSock->u8RecvQueueHead].u16BufferSize;
+    }
+
+    return (uint16_t)u32Size;
+}
+
+/*********************************************************************
+Function
+        Socket_RecvRequest
+
+Description
+        Issue a receive request to the firmware for the buffers currently
+        posted to the socket, unless one is already pending.
+
+Return
+        SOCK_ERR_NO_ERROR if the request was sent or is already pending,
+        SOCK_ERR_BUFFER_FULL otherwise.
+*********************************************************************/
+static int16_t Socket_RecvRequest(SOCKET sock)
+{
+    int16_t s16Ret = SOCK_ERR_NO_ERROR;
+
+    if((!gastrSockets[sock].bIsRecvPending) && (gastrSockets[sock].u8RecvQueueCount > 0))
+    {
+        tstrRecvCmd strRecv;
+
+        gastrSockets[sock].bIsRecvPending = 1;
+
+        strRecv.u32Timeoutmsec  = gastrSockets[sock].u32RecvTimeoutmsec;
+        strRecv.sock            = sock;
+        strRecv.u16SessionID    = gastrSockets[sock].u16SessionID;
+        strRecv.u16BufLen       = Socket_RecvQueueSize(sock);
+
+        s16Ret = SOCKET_REQUEST(gastrSockets[sock].u8RecvCmd, (uint8_t*)&strRecv, sizeof(tstrRecvCmd), NULL , 0, 0);
+        SOCKET_STATS_ADD(sock, u32HifSends, 1);
+        if(s16Ret != SOCK_ERR_NO_ERROR)
+        {
+            SOCKET_STATS_ADD(sock, u32HifSendFails, 1);
+            s16Ret = SOCK_ERR_BUFFER_FULL;
+        }
+    }
+    return s16Ret;
+}
+
 /*********************************************************************
 Function
         Socket_ReadSocketData
@@ -128,6 +322,10 @@ Function
 Description
         Callback function used by the NMC1500 driver to deliver messages
         for socket layer.
+        The data is read into the posted receive buffers in the order they
+        were posted, the next receive request is issued if further buffers
+        remain posted, then one event per filled buffer is delivered to
+        the application.
 
 Return
         None.
@@ -144,38 +342,73 @@ Date
 static void Socket_ReadSocketData(SOCKET sock, tstrSocketRecvMsg *pstrRecv,uint8_t u8SocketMsg,
                                   uint32_t u32StartAddress,uint16_t u16ReadCount)
 {
-    uint32_t  u32Address = u32StartAddress;
-    uint16_t  u16Read;
-    int16_t   s16Diff;
+    volatile tstrSocket *pstrSock = &gastrSockets[sock];
+    tstrSocketRecvBuf   astrFilled[SOCKET_RX_BUFFER_QUEUE_DEPTH];
+    uint8_t             u8NumFilled = 0;
+    uint32_t            u32Address = u32StartAddress;
+    uint16_t            u16Remaining = u16ReadCount;
+    uint8_t             u8Count;
 
     pstrRecv->u16RemainingSize = u16ReadCount;
-    if((u16ReadCount > 0) && (gastrSockets[sock].pu8UserBuffer != NULL) && (gastrSockets[sock].u16UserBufferSize > 0) && (gastrSockets[sock].bIsUsed == 1))
+    if((u16ReadCount == 0) || (pstrSock->bIsUsed != 1))
+        return;
+
+    while((u16Remaining > 0) && (pstrSock->u8RecvQueueCount > 0))
     {
-        u16Read = u16ReadCount;
-        s16Diff = u16Read - gastrSockets[sock].u16UserBufferSize;
-        if(s16Diff > 0)
-        {
-            /* We don't expect to be here. Firmware 19.6.4 and later only sends data to the driver according to the application's buffer size.
-             * But it is worth keeping this check, eg in case the application calls recv again with a smaller buffer size, or in case of HIF hacking. */
-            u16Read = gastrSockets[sock].u16UserBufferSize;
-        }
+        volatile tstrSocketRecvBuf *pstrBuf = &pstrSock->astrRecvQueue[pstrSock->u8RecvQueueHead];
+        uint16_t                    u16Read = u16Remaining;
+        uint8_t                     bIsDone;
 
-        if(hif_receive(u32Address, gastrSockets[sock].pu8UserBuffer, u16Read, 1) == M2M_SUCCESS)
+        if((pstrBuf->pu8Buffer == NULL) || (pstrBuf->u16BufferSize == 0))
+            break;
+
+        if(u16Read > pstrBuf->u16BufferSize)
         {
-            pstrRecv->pu8Buffer         = gastrSockets[sock].pu8UserBuffer;
-            pstrRecv->s16BufferSize     = u16Read;
-            pstrRecv->u16RemainingSize  -= u16Read;
+            /* Firmware 19.6.4 and later only sends data to the driver according to the posted buffer sizes.
+             * But it is worth keeping this check, eg in case the application posts a smaller buffer, or in case of HIF hacking. */
+            u16Read = pstrBuf->u16BufferSize;
+        }
 
-            gastrSockets[sock].u16UserBufferSize = 0;
-            gastrSockets[sock].pu8UserBuffer = NULL;
+        /* Datagrams are never split across buffers, so any excess is discarded. */
+        bIsDone = ((u16Read == u16Remaining) || (sock >= TCP_SOCK_MAX) || (pstrSock->u8RecvQueueCount == 1)) ? 1 : 0;
 
-            if(gpfAppSocketCb)
-                gpfAppSocketCb(sock, u8SocketMsg, pstrRecv);
-        }
-        else
+        if(hif_receive(u32Address, pstrBuf->pu8Buffer, u16Read, bIsDone) != M2M_SUCCESS)
         {
             M2M_ERR("Current <%d>\r\n", u16ReadCount);
+            break;
         }
+
+        astrFilled[u8NumFilled].pu8Buffer       = Socket_RecvQueuePop(sock);
+        astrFilled[u8NumFilled].u16BufferSize   = u16Read;
+        u8NumFilled++;
+
+        u32Address      += u16Read;
+        u16Remaining    -= u16Read;
+
+        if(bIsDone)
+            break;
+    }
+
+    if(u8NumFilled == 0)
+    {
+        SOCKET_STATS_ADD(sock, u32RecvUnderruns, 1);
+        return;
+    }
+
+    /* Keep the firmware busy with the remaining posted buffers while the application
+     * consumes the ones just filled. */
+    Socket_RecvRequest(sock);
+
+    for(u8Count = 0; u8Count < u8NumFilled; u8Count++)
+    {
+        pstrRecv->pu8Buffer         = astrFilled[u8Count].pu8Buffer;
+        pstrRecv->s16BufferSize     = astrFilled[u8Count].u16BufferSize;
+        pstrRecv->u16RemainingSize  -= astrFilled[u8Count].u16BufferSize;
+
+        SOCKET_STATS_ADD(sock, u32MsgsIn, 1);
+        SOCKET_STATS_ADD(sock, u32BytesIn, astrFilled[u8Count].u16BufferSize);
+
+        Socket_AppCallback(sock, u8SocketMsg, pstrRecv);
     }
 }
 
@@ -201,6 +434,10 @@ Date
 *********************************************************************/
 static void m2m_ip_cb(uint8_t u8OpCode, uint16_t u16BufferSize,uint32_t u32Address)
 {
+#ifdef CONF_WINC_SOCKET_STATS
+    gu32SockEventTime = SYS_TIME_CounterGet();
+#endif
+
     if((u8OpCode == SOCKET_CMD_BIND) || (u8OpCode == SOCKET_CMD_SSL_BIND))
     {
         tstrBindReply       strBindReply;
@@ -209,8 +446,7 @@ static void m2m_ip_cb(uint8_t u8OpCode, uint16_t u16BufferSize,uint32_t u32Addre
         if(hif_receive(u32Address, (uint8_t*)&strBindReply, sizeof(tstrBindReply), 0) == M2M_SUCCESS)
         {
             strBind.status = strBindReply.s8Status;
-            if(gpfAppSocketCb)
-                gpfAppSocketCb(strBindReply.sock, SOCKET_MSG_BIND, &strBind);
+            Socket_AppCallback(strBindReply.sock, SOCKET_MSG_BIND, &strBind);
         }
     }
     else if(u8OpCode == SOCKET_CMD_LISTEN)
@@ -220,8 +456,7 @@ static void m2m_ip_cb(uint8_t u8OpCode, uint16_t u16BufferSize,uint32_t u32Addre
         if(hif_receive(u32Address, (uint8_t*)&strListenReply, sizeof(tstrListenReply), 0) == M2M_SUCCESS)
         {
             strListen.status = strListenReply.s8Status;
-            if(gpfAppSocketCb)
-                gpfAppSocketCb(strListenReply.sock, SOCKET_MSG_LISTEN, &strListen);
+            Socket_AppCallback(strListenReply.sock, SOCKET_MSG_LISTEN, &strListen);
         }
     }
     else if(u8OpCode == SOCKET_CMD_ACCEPT)
@@ -249,8 +484,7 @@ static void m2m_ip_cb(uint8_t u8OpCode, uint16_t u16BufferSize,uint32_t u32Addre
             strAccept.strAddr.sin_family        = AF_INET;
             strAccept.strAddr.sin_port = strAcceptReply.strAddr.u16Port;
             strAccept.strAddr.sin_addr.s_addr = strAcceptReply.strAddr.u32IPAddr;
-            if(gpfAppSocketCb)
-                gpfAppSocketCb(strAcceptReply.sListenSock, SOCKET_MSG_ACCEPT, &strAccept);
+            Socket_AppCallback(strAcceptReply.sListenSock, SOCKET_MSG_ACCEPT, &strAccept);
         }
     }
     else if((u8OpCode == SOCKET_CMD_CONNECT) || (u8OpCode == SOCKET_CMD_SSL_CONNECT) || (u8OpCode == SOCKET_CMD_SSL_CONNECT_ALPN))
@@ -286,8 +520,7 @@ static void m2m_ip_cb(uint8_t u8OpCode, uint16_t u16BufferSize,uint32_t u32Addre
                     gastrSockets[strConnMsg.sock].u8ErrSource = strConnectAlpnReply.strConnReply.u8ErrSource;
                     gastrSockets[strConnMsg.sock].u8ErrCode = strConnectAlpnReply.strConnReply.u8ErrCode;
                 }
-                if(gpfAppSocketCb)
-                    gpfAppSocketCb(strConnMsg.sock, u8Msg, &strConnMsg);
+                Socket_AppCallback(strConnMsg.sock, u8Msg, &strConnMsg);
             }
         }
     }
@@ -354,11 +587,15 @@ static void m2m_ip_cb(uint8_t u8OpCode, uint16_t u16BufferSize,uint32_t u32Addre
                     else
                     {
                         /* Don't tidy up here. Application must call close().
+                        The failed request completes the buffer at the head of the queue, so
+                        return it to the application. After a timeout the socket remains open,
+                        so keep the firmware busy with any further posted buffers.
                         */
                         strRecvMsg.s16BufferSize    = s16RecvStatus;
-                        strRecvMsg.pu8Buffer        = NULL;
-                        if(gpfAppSocketCb)
-                            gpfAppSocketCb(sock, u8CallbackMsgID, &strRecvMsg);
+                        strRecvMsg.pu8Buffer        = Socket_RecvQueuePop(sock);
+                        if(s16RecvStatus == SOCK_ERR_TIMEOUT)
+                            Socket_RecvRequest(sock);
+                        Socket_AppCallback(sock, u8CallbackMsgID, &strRecvMsg);
                     }
                 }
                 else
@@ -397,8 +634,7 @@ static void m2m_ip_cb(uint8_t u8OpCode, uint16_t u16BufferSize,uint32_t u32Addre
 
                 if(u16SessionID == gastrSockets[sock].u16SessionID)
                 {
-                    if(gpfAppSocketCb)
-                        gpfAppSocketCb(sock, u8CallbackMsgID, &s16Rcvd);
+                    Socket_AppCallback(sock, u8CallbackMsgID, &s16Rcvd);
                 }
                 else
                 {
@@ -446,6 +682,9 @@ void socketInit(void)
         hif_register_cb(M2M_REQ_GROUP_IP, m2m_ip_cb);
         gbSocketInit    = 1;
         gu16SessionID   = 0;
+#ifdef CONF_WINC_SOCKET_STATS
+        reset_socket_stats();
+#endif
     }
 }
 
@@ -573,6 +812,9 @@ SOCKET socket(uint16_t u16Domain, uint8_t u8Type, uint8_t u8Config)
         {
             memset((uint8_t*)pstrSock, 0, sizeof(tstrSocket));
             pstrSock->bIsUsed = 1;
+#ifdef CONF_WINC_SOCKET_STATS
+            memset(&gastrSockStats[sock], 0, sizeof(tstrSockStats));
+#endif
 
             /* The session ID is used to distinguish different socket connections
                 by comparing the assigned session ID to the one reported by the firmware*/
@@ -801,6 +1043,39 @@ int8_t secure(SOCKET sock)
     return s8Ret;
 }
 /*********************************************************************
+Function
+        Socket_SendSegsPrepare
+
+Description
+        Validates a list of send segments and converts it to HIF segments.
+
+Return
+        Total length of the segments, or a negative value if invalid.
+*********************************************************************/
+static int32_t Socket_SendSegsPrepare(const tstrSockSendSeg *pstrSegs, uint8_t u8NumSegs, tstrHifDataSeg *pstrHifSegs)
+{
+    int32_t s32Length = 0;
+    uint8_t u8Seg;
+
+    if((pstrSegs == NULL) || (u8NumSegs == 0) || (u8NumSegs > SOCKET_SEND_MAX_SEGMENTS))
+        return -1;
+
+    for(u8Seg = 0; u8Seg < u8NumSegs; u8Seg++)
+    {
+        if(pstrSegs[u8Seg].pvBuffer == NULL)
+            return -1;
+
+        pstrHifSegs[u8Seg].pu8Buf   = (uint8_t*)pstrSegs[u8Seg].pvBuffer;
+        pstrHifSegs[u8Seg].u16Size  = pstrSegs[u8Seg].u16Length;
+        s32Length += pstrSegs[u8Seg].u16Length;
+    }
+
+    if(s32Length > SOCKET_BUFFER_MAX_LENGTH)
+        return -1;
+
+    return s32Length;
+}
+/*********************************************************************
 Function
         send
 
@@ -819,9 +1094,33 @@ Date
 *********************************************************************/
 int16_t send(SOCKET sock, void *pvSendBuffer, uint16_t u16SendLength, uint16_t flags)
 {
-    int16_t s16Ret = SOCK_ERR_INVALID_ARG;
+    tstrSockSendSeg strSeg;
+
+    strSeg.pvBuffer     = pvSendBuffer;
+    strSeg.u16Length    = u16SendLength;
+
+    return sendv(sock, &strSeg, 1, flags);
+}
+/*********************************************************************
+Function
+        sendv
+
+Description
+        Gathering variant of send, the segments are written to the
+        firmware packet buffer back to back.
 
-    if((sock >= 0) && (sock < MAX_SOCKET) && (pvSendBuffer != NULL) && (u16SendLength <= SOCKET_BUFFER_MAX_LENGTH) && (gastrSockets[sock].bIsUsed == 1))
+Return
+        SOCK_ERR_NO_ERROR on success, a negative value otherwise.
+*********************************************************************/
+int16_t sendv(SOCKET sock, const tstrSockSendSeg *pstrSegs, uint8_t u8NumSegs, uint16_t flags)
+{
+    int16_t         s16Ret = SOCK_ERR_INVALID_ARG;
+    tstrHifDataSeg  astrHifSegs[SOCKET_SEND_MAX_SEGMENTS];
+    int32_t         s32SendLength;
+
+    s32SendLength = Socket_SendSegsPrepare(pstrSegs, u8NumSegs, astrHifSegs);
+
+    if((sock >= 0) && (sock < MAX_SOCKET) && (s32SendLength >= 0) && (gastrSockets[sock].bIsUsed == 1))
     {
         uint16_t        u16DataOffset;
         tstrSendCmd     strSend;
@@ -831,7 +1130,7 @@ int16_t send(SOCKET sock, void *pvSendBuffer, uint16_t u16SendLength, uint16_t f
         u16DataOffset   = TCP_TX_PACKET_OFFSET;
 
         strSend.sock            = sock;
-        strSend.u16DataSize     = NM_BSP_B_L_16(u16SendLength);
+        strSend.u16DataSize     = NM_BSP_B_L_16((uint16_t)s32SendLength);
         strSend.u16SessionID    = gastrSockets[sock].u16SessionID;
 
         if(sock >= TCP_SOCK_MAX)
@@ -847,11 +1146,18 @@ int16_t send(SOCKET sock, void *pvSendBuffer, uint16_t u16SendLength, uint16_t f
             u16DataOffset   = gastrSockets[sock].u16DataOffset;
         }
 
-        s16Ret =  SOCKET_REQUEST(u8Cmd|M2M_REQ_DATA_PKT, (uint8_t*)&strSend, sizeof(tstrSendCmd), pvSendBuffer, u16SendLength, u16DataOffset);
+        s16Ret =  SOCKET_REQUEST_VEC(u8Cmd|M2M_REQ_DATA_PKT, (uint8_t*)&strSend, sizeof(tstrSendCmd), astrHifSegs, u8NumSegs, u16DataOffset);
+        SOCKET_STATS_ADD(sock, u32HifSends, 1);
         if(s16Ret != SOCK_ERR_NO_ERROR)
         {
+            SOCKET_STATS_ADD(sock, u32HifSendFails, 1);
             s16Ret = SOCK_ERR_BUFFER_FULL;
         }
+        else
+        {
+            SOCKET_STATS_ADD(sock, u32MsgsOut, 1);
+            SOCKET_STATS_ADD(sock, u32BytesOut, s32SendLength);
+        }
     }
     return s16Ret;
 }
@@ -874,36 +1180,64 @@ Date
 *********************************************************************/
 int16_t sendto(SOCKET sock, void *pvSendBuffer, uint16_t u16SendLength, uint16_t flags, struct sockaddr *pstrDestAddr, uint8_t u8AddrLen)
 {
-    int16_t s16Ret = SOCK_ERR_INVALID_ARG;
+    tstrSockSendSeg strSeg;
+
+    strSeg.pvBuffer     = pvSendBuffer;
+    strSeg.u16Length    = u16SendLength;
+
+    return sendtov(sock, &strSeg, 1, flags, pstrDestAddr, u8AddrLen);
+}
+/*********************************************************************
+Function
+        sendtov
 
-    if((sock >= 0) && (sock < MAX_SOCKET) && (pvSendBuffer != NULL) && (u16SendLength <= SOCKET_BUFFER_MAX_LENGTH) && (gastrSockets[sock].bIsUsed == 1))
+Description
+        Gathering variant of sendto, the segments are written to the
+        firmware packet buffer back to back.
+
+Return
+        SOCK_ERR_NO_ERROR on success, a negative value otherwise.
+*********************************************************************/
+int16_t sendtov(SOCKET sock, const tstrSockSendSeg *pstrSegs, uint8_t u8NumSegs, uint16_t flags, struct sockaddr *pstrDestAddr, uint8_t u8AddrLen)
+{
+    int16_t         s16Ret = SOCK_ERR_INVALID_ARG;
+    tstrHifDataSeg  astrHifSegs[SOCKET_SEND_MAX_SEGMENTS];
+    int32_t         s32SendLength;
+
+    s32SendLength = Socket_SendSegsPrepare(pstrSegs, u8NumSegs, astrHifSegs);
+
+    if((sock >= 0) && (sock < MAX_SOCKET) && (s32SendLength >= 0) && (gastrSockets[sock].bIsUsed == 1))
     {
-        if(gastrSockets[sock].bIsUsed)
-        {
-            tstrSendCmd strSendTo;
+        tstrSendCmd strSendTo;
 
-            memset((uint8_t*)&strSendTo, 0, sizeof(tstrSendCmd));
+        memset((uint8_t*)&strSendTo, 0, sizeof(tstrSendCmd));
 
-            strSendTo.sock          = sock;
-            strSendTo.u16DataSize   = NM_BSP_B_L_16(u16SendLength);
-            strSendTo.u16SessionID  = gastrSockets[sock].u16SessionID;
+        strSendTo.sock          = sock;
+        strSendTo.u16DataSize   = NM_BSP_B_L_16((uint16_t)s32SendLength);
+        strSendTo.u16SessionID  = gastrSockets[sock].u16SessionID;
 
-            if(pstrDestAddr != NULL)
-            {
-                struct sockaddr_in  *pstrAddr;
-                pstrAddr = (void*)pstrDestAddr;
+        if(pstrDestAddr != NULL)
+        {
+            struct sockaddr_in  *pstrAddr;
+            pstrAddr = (void*)pstrDestAddr;
 
-                strSendTo.strAddr.u16Family = pstrAddr->sin_family;
-                strSendTo.strAddr.u16Port   = pstrAddr->sin_port;
-                strSendTo.strAddr.u32IPAddr = pstrAddr->sin_addr.s_addr;
-            }
-            s16Ret = SOCKET_REQUEST(SOCKET_CMD_SENDTO|M2M_REQ_DATA_PKT, (uint8_t*)&strSendTo,  sizeof(tstrSendCmd),
-                                    pvSendBuffer, u16SendLength, UDP_TX_PACKET_OFFSET);
+            strSendTo.strAddr.u16Family = pstrAddr->sin_family;
+            strSendTo.strAddr.u16Port   = pstrAddr->sin_port;
+            strSendTo.strAddr.u32IPAddr = pstrAddr->sin_addr.s_addr;
+        }
+        s16Ret = SOCKET_REQUEST_VEC(SOCKET_CMD_SENDTO|M2M_REQ_DATA_PKT, (uint8_t*)&strSendTo,  sizeof(tstrSendCmd),
+                                astrHifSegs, u8NumSegs, UDP_TX_PACKET_OFFSET);
+        SOCKET_STATS_ADD(sock, u32HifSends, 1);
 
-            if(s16Ret != SOCK_ERR_NO_ERROR)
-            {
-                s16Ret = SOCK_ERR_BUFFER_FULL;
-            }
+        if(s16Ret != SOCK_ERR_NO_ERROR)
+        {
+            SOCKET_STATS_ADD(sock, u32HifSendFails, 1);
+            s16Ret = SOCK_ERR_BUFFER_FULL;
+        }
+        else
+        {
+            SOCKET_STATS_ADD(sock, u32MsgsOut, 1);
+            SOCKET_STATS_ADD(sock, u32BytesOut, s32SendLength);
         }
     }
     return s16Ret;
@@ -933,39 +1267,26 @@ int16_t recv(SOCKET sock, void *pvRecvBuf, uint16_t u16BufLen, uint32_t u32Timeo
 
     if((sock >= 0) && (sock < MAX_SOCKET) && (pvRecvBuf != NULL) && (u16BufLen != 0) && (gastrSockets[sock].bIsUsed == 1))
     {
-        s16Ret = SOCK_ERR_NO_ERROR;
-        gastrSockets[sock].pu8UserBuffer        = (uint8_t*)pvRecvBuf;
-        gastrSockets[sock].u16UserBufferSize    = u16BufLen;
+        uint8_t u8Cmd = SOCKET_CMD_RECV;
 
-        if(!gastrSockets[sock].bIsRecvPending)
+        if(
+                (gastrSockets[sock].u8SSLFlags & SSL_FLAGS_ACTIVE)
+            &&  (!(gastrSockets[sock].u8SSLFlags & SSL_FLAGS_DELAY))
+        )
         {
-            tstrRecvCmd strRecv;
-            uint8_t     u8Cmd = SOCKET_CMD_RECV;
+            u8Cmd = SOCKET_CMD_SSL_RECV;
+        }
 
-            gastrSockets[sock].bIsRecvPending = 1;
-            if(
-                    (gastrSockets[sock].u8SSLFlags & SSL_FLAGS_ACTIVE)
-                &&  (!(gastrSockets[sock].u8SSLFlags & SSL_FLAGS_DELAY))
-            )
-            {
-                u8Cmd = SOCKET_CMD_SSL_RECV;
-            }
+        /* Check the timeout value. */
+        if(u32Timeoutmsec == 0)
+            gastrSockets[sock].u32RecvTimeoutmsec = 0xFFFFFFFF;
+        else
+            gastrSockets[sock].u32RecvTimeoutmsec = NM_BSP_B_L_32(u32Timeoutmsec);
 
-            /* Check the timeout value. */
-            if(u32Timeoutmsec == 0)
-                strRecv.u32Timeoutmsec = 0xFFFFFFFF;
-            else
-                strRecv.u32Timeoutmsec = NM_BSP_B_L_32(u32Timeoutmsec);
-            strRecv.sock = sock;
-            strRecv.u16SessionID        = gastrSockets[sock].u16SessionID;
-            strRecv.u16BufLen           = u16BufLen;
-		
-            s16Ret = SOCKET_REQUEST(u8Cmd, (uint8_t*)&strRecv, sizeof(tstrRecvCmd), NULL , 0, 0);
-            if(s16Ret != SOCK_ERR_NO_ERROR)
-            {
-                s16Ret = SOCK_ERR_BUFFER_FULL;
-            }
-        }
+        gastrSockets[sock].u8RecvCmd = u8Cmd;
+        Socket_RecvQueuePost(sock, (uint8_t*)pvRecvBuf, u16BufLen);
+
+        s16Ret = Socket_RecvRequest(sock);
     }
     return s16Ret;
 }
@@ -1037,33 +1358,16 @@ int16_t recvfrom(SOCKET sock, void *pvRecvBuf, uint16_t u16BufLen, uint32_t u32T
     int16_t s16Ret = SOCK_ERR_NO_ERROR;
     if((sock >= 0) && (sock < MAX_SOCKET) && (pvRecvBuf != NULL) && (u16BufLen != 0) && (gastrSockets[sock].bIsUsed == 1))
     {
-        if(gastrSockets[sock].bIsUsed)
-        {
-            s16Ret = SOCK_ERR_NO_ERROR;
-            gastrSockets[sock].pu8UserBuffer = (uint8_t*)pvRecvBuf;
-            gastrSockets[sock].u16UserBufferSize = u16BufLen;
+        /* Check the timeout value. */
+        if(u32Timeoutmsec == 0)
+            gastrSockets[sock].u32RecvTimeoutmsec = 0xFFFFFFFF;
+        else
+            gastrSockets[sock].u32RecvTimeoutmsec = NM_BSP_B_L_32(u32Timeoutmsec);
 
-            if(!gastrSockets[sock].bIsRecvPending)
-            {
-                tstrRecvCmd strRecv;
-                gastrSockets[sock].bIsRecvPending = 1;
+        gastrSockets[sock].u8RecvCmd = SOCKET_CMD_RECVFROM;
+        Socket_RecvQueuePost(sock, (uint8_t*)pvRecvBuf, u16BufLen);
 
-                /* Check the timeout value. */
-                if(u32Timeoutmsec == 0)
-                    strRecv.u32Timeoutmsec = 0xFFFFFFFF;
-                else
-                    strRecv.u32Timeoutmsec = NM_BSP_B_L_32(u32Timeoutmsec);
-                strRecv.sock = sock;
-                strRecv.u16SessionID        = gastrSockets[sock].u16SessionID;
-                strRecv.u16BufLen           = u16BufLen;
-				
-                s16Ret = SOCKET_REQUEST(SOCKET_CMD_RECVFROM, (uint8_t*)&strRecv, sizeof(tstrRecvCmd), NULL , 0, 0);
-                if(s16Ret != SOCK_ERR_NO_ERROR)
-                {
-                    s16Ret = SOCK_ERR_BUFFER_FULL;
-                }
-            }
-        }
+        s16Ret = Socket_RecvRequest(sock);
     }
     else
     {
@@ -1451,4 +1755,49 @@ int8_t get_error_detail(SOCKET sock, tstrSockErr *pstrErr)
     return SOCK_ERR_NO_ERROR;
 }
 
+#ifdef CONF_WINC_SOCKET_STATS
+/*********************************************************************
+Function
+    get_socket_stats
+
+Description
+    This function gets the traffic statistics of a socket, or of all
+    sockets combined if sock is SOCKET_STATS_ALL.
+
+Return
+    The function returns @ref SOCK_ERR_NO_ERROR if the request is successful
+    and a negative value otherwise.
+*********************************************************************/
+int8_t get_socket_stats(SOCKET sock, tstrSockStats *pstrStats)
+{
+    if(pstrStats == NULL)
+        return SOCK_ERR_INVALID_ARG;
+    if(sock == SOCKET_STATS_ALL)
+    {
+        memcpy(pstrStats, &gstrSockStatsAll, sizeof(tstrSockStats));
+        return SOCK_ERR_NO_ERROR;
+    }
+    if((sock >= MAX_SOCKET) || (sock < 0))
+        return SOCK_ERR_INVALID_ARG;
+    memcpy(pstrStats, &gastrSockStats[sock], sizeof(tstrSockStats));
+    return SOCK_ERR_NO_ERROR;
+}
+
+/*********************************************************************
+Function
+    reset_socket_stats
+
+Description
+    This function clears the statistics of all sockets.
+
+Return
+    None.
+*********************************************************************/
+void reset_socket_stats(void)
+{
+    memset(gastrSockStats, 0, sizeof(gastrSockStats));
+    memset(&gstrSockStatsAll, 0, sizeof(tstrSockStats));
+}
+#endif
+
 //DOM-IGNORE-END
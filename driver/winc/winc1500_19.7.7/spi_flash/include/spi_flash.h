@@ -219,4 +219,33 @@ int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
 int8_t spi_flash_erase(uint32_t u32Offset, uint32_t u32Sz);
  /**@}*/
 
+  /** @defgroup SPiFlashUpdate spi_flash_update
+ *  @ingroup SPIFLASHAPI
+ */
+  /**@{*/
+/*!
+ * @fn             int8_t spi_flash_update(uint8_t *, uint32_t, uint32_t);
+ * @brief          Reprogram a portion of SPI Flash, erasing and writing only the sectors which differ.\n
+ *                 Each sector is read back and compared with the new data, sectors which already hold
+ *                 the new data are left untouched. The result is the same as @ref spi_flash_erase
+ *                 followed by @ref spi_flash_write over the same range.
+ * @param [in]     pu8Buf
+ *                 Pointer to data buffer holding the new contents.
+ * @param [in]     u32Offset
+ *                 Address (Offset) to write at the SPI flash, must be aligned with a sector boundary.
+ * @param [in]     u32Sz
+ *                 Total size of data
+ * @note         It is blocking function \n
+ *                 If the range ends part way through a sector, the remainder of that sector is erased
+ *                 unless it is already erased and the data matches, as with @ref spi_flash_erase.
+ * @warning
+ *                 - In case of there is a running firmware, it is required to pause your firmware first
+ *                   before any trial to access SPI flash to avoid any racing between host and running firmware on bus using
+ *                   @ref m2m_wifi_download_mode
+ * @sa             m2m_wifi_download_mode, spi_flash_erase, spi_flash_write
+ * @return       The function returns @ref M2M_SUCCESS for successful operations  and a negative value otherwise.
+ */
+int8_t spi_flash_update(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
+ /**@}*/
+
 #endif  //__SPI_FLASH_H__
@@ -305,6 +305,24 @@ ERR:
     return ret;
 }
 
+/**
+*   @fn         spi_flash_is_erased
+*   @brief      Check whether a buffer holds only erased (0xFF) bytes
+*   @param[IN]  pu8Buf
+*                   Pointer to data buffer
+*   @param[IN]  u32Sz
+*                   Data size
+*   @return     1 if all bytes are 0xFF, 0 otherwise
+*/
+static uint8_t spi_flash_is_erased(const uint8_t *pu8Buf, uint32_t u32Sz)
+{
+    while(u32Sz--)
+    {
+        if(*pu8Buf++ != 0xff) return 0;
+    }
+    return 1;
+}
+
 /**
 *   @fn         spi_flash_pp
 *   @brief      Program data of size less than a page (256 bytes) at the SPI flash
@@ -322,6 +340,8 @@ static int8_t spi_flash_pp(uint32_t u32Offset, uint8_t *pu8Buf, uint16_t u16Sz)
 {
     int8_t ret = M2M_SUCCESS;
     uint8_t tmp;
+    /* Programming 0xFF leaves the flash unchanged, so skip it. */
+    if(spi_flash_is_erased(pu8Buf, u16Sz)) goto ERR;
     spi_flash_write_enable();
     /* use shared packet memory as temp mem */
     ret += nm_write_block(HOST_SHARE_MEM_BASE, pu8Buf, u16Sz);
@@ -575,6 +595,80 @@ ERR:
     return ret;
 }
 
+/**
+*   @fn         spi_flash_update
+*   @brief      Reprogram SPI flash, erasing and writing only the sectors which differ
+*   @param[IN]  pu8Buf
+*                   Pointer to data buffer
+*   @param[IN]  u32Offset
+*                   Sector aligned address to write to at the SPI flash
+*   @param[IN]  u32Sz
+*                   Data size
+*   @return     Status of execution
+*/
+int8_t spi_flash_update(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
+{
+    int8_t ret = M2M_SUCCESS;
+    uint8_t au8Page[FLASH_PAGE_SZ];
+
+    if((pu8Buf == NULL) || (u32Sz == 0) || (u32Offset % FLASH_SECTOR_SZ))
+    {
+        M2M_ERR("Invalid update region %lx %lu\r\n", u32Offset, u32Sz);
+        ret = M2M_ERR_INVALID_ARG;
+        goto ERR;
+    }
+
+    while(u32Sz > 0)
+    {
+        uint32_t u32SectorSz = BSP_MIN(u32Sz, FLASH_SECTOR_SZ);
+        uint32_t u32Pos;
+        uint8_t  u8Changed = 0;
+
+        /* Compare the sector with the new data a page at a time. */
+        for(u32Pos = 0; u32Pos < u32SectorSz; u32Pos += FLASH_PAGE_SZ)
+        {
+            uint32_t u32PageSz = BSP_MIN(u32SectorSz - u32Pos, FLASH_PAGE_SZ);
+
+            ret = spi_flash_read_internal(au8Page, u32Offset + u32Pos, u32PageSz);
+            if(M2M_SUCCESS != ret) goto ERR;
+
+            if(memcmp(au8Page, &pu8Buf[u32Pos], u32PageSz))
+            {
+                u8Changed = 1;
+                break;
+            }
+        }
+
+        /* Erasing the range clears the tail of a partial last sector, so it must be erased too. */
+        for(u32Pos = u32SectorSz; (!u8Changed) && (u32Pos < FLASH_SECTOR_SZ); u32Pos += FLASH_PAGE_SZ)
+        {
+            uint32_t u32PageSz = BSP_MIN(FLASH_SECTOR_SZ - u32Pos, FLASH_PAGE_SZ);
+
+            ret = spi_flash_read_internal(au8Page, u32Offset + u32Pos, u32PageSz);
+            if(M2M_SUCCESS != ret) goto ERR;
+
+            if(!spi_flash_is_erased(au8Page, u32PageSz))
+            {
+                u8Changed = 1;
+            }
+        }
+
+        if(u8Changed)
+        {
+            ret = spi_flash_erase(u32Offset, FLASH_SECTOR_SZ);
+            if(M2M_SUCCESS != ret) goto ERR;
+            ret = spi_flash_write(pu8Buf, u32Offset, u32SectorSz);
+            if(M2M_SUCCESS != ret) goto ERR;
+        }
+
+        pu8Buf += u32SectorSz;
+        u32Offset += u32SectorSz;
+        u32Sz -= u32SectorSz;
+    }
+ERR:
+    return ret;
+}
+
 /**
 *   @fn         spi_flash_get_size
 *   @brief      Get size of SPI Flash
@@ -38,6 +38,7 @@ Microchip or any third party.
 #include "winc_asic.h"
 #include "winc_spi.h"
 #include "spi_flash/winc_spi_flash.h"
+#include "spi_flash/winc_flexible_flash.h"
 
 int_fast8_t winc_drv_init(bool bHold)
 {
@@ -79,6 +80,9 @@ int_fast8_t winc_drv_init(bool bHold)
 
 int_fast8_t winc_drv_start(bool bBootATE, bool bEthMode, uint32_t u32StateRegVal)
 {
+    /* The running firmware may rewrite the flash map, e.g. on an OTA switch. */
+    spi_flexible_flash_invalidate(0, 0xFFFFFFFF);
+
     if (winc_chip_init(bBootATE, bEthMode, u32StateRegVal))
     {
         return WINC_DRV_SUCCESS;
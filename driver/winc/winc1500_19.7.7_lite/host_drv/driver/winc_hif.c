@@ -42,6 +42,9 @@ static uint_fast8_t         gu8ChipSleep;
 static uint32_t             gu32RxAddr;
 static uint_fast16_t        gu16RxSize;
 static bool                 gbChipPwrSave;
+#ifdef CONF_WINC_HIF_STATS
+static tstrHifIsrStats      gstrHifIsrStats;
+#endif
 
 static void hif_null_cb(uint8_t u8OpCode, uint16_t u16DataSize, uint32_t u32Addr)
 {
@@ -257,34 +260,12 @@ int8_t winc_hif_send_no_data(uint8_t u8Gid, uint8_t u8Opcode, const void *pvCtrl
     return winc_hif_send(u8Gid, u8Opcode, pvCtrlBuf, u16CtrlBufSize, NULL, 0, 0);
 }
 
-int8_t winc_hif_handle_isr(void)
+/* Handle one message signalled in WIFI_HOST_RCV_CTRL_0, entered with the HIF
+ * critical section held which is released before the callback is run. */
+static int8_t winc_hif_isr_message(uint32_t u32Reg)
 {
-    uint32_t u32Reg;
     tstrHifHdr strHif;
 
-    if (!winc_bsp_interrupt_request_pending())
-    {
-        return M2M_SUCCESS;
-    }
-
-    WINC_CRIT_SEC_HIF_ENTER;
-
-    if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(WIFI_HOST_RCV_CTRL_0, &u32Reg))
-    {
-        WINC_LOG_ERROR("Failed to read interrupt register");
-
-        WINC_CRIT_SEC_HIF_LEAVE;
-        return M2M_ERR_FAIL;
-    }
-
-    if (!(u32Reg & NBIT0))
-    {
-        WINC_LOG_ERROR("False interrupt %" PRIx32, u32Reg);
-
-        WINC_CRIT_SEC_HIF_LEAVE;
-        return M2M_ERR_FAIL;
-    }
-
     /* New interrupt has been received */
     /*Clearing RX interrupt*/
     u32Reg &= (uint32_t)(~NBIT0);
@@ -344,8 +325,10 @@ int8_t winc_hif_handle_isr(void)
 
     winc_bsp_interrupt_serviced(true);
 
-    /* Set RX Done */
-    winc_bus_set_reg_bits(WIFI_HOST_RCV_CTRL_0, NBIT1);
+    /* Set RX Done, the firmware does not post another message until it sees
+     * RX done so the value written when clearing the interrupt still holds.
+     * The clear itself cannot be deferred to here as it releases IRQn. */
+    winc_bus_write_reg(WIFI_HOST_RCV_CTRL_0, u32Reg | NBIT1);
 
     winc_bsp_interrupt_serviced(false);
 
@@ -357,6 +340,101 @@ int8_t winc_hif_handle_isr(void)
     return M2M_SUCCESS;
 }
 
+int8_t winc_hif_handle_isr(void)
+{
+    uint32_t u32Reg;
+    uint_fast8_t u8NumMsgs = 0;
+    int8_t s8Ret;
+
+    if (!winc_bsp_interrupt_request_pending())
+    {
+        return M2M_SUCCESS;
+    }
+
+    WINC_CRIT_SEC_HIF_ENTER;
+
+    if (WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(WIFI_HOST_RCV_CTRL_0, &u32Reg))
+    {
+        WINC_LOG_ERROR("Failed to read interrupt register");
+
+        WINC_CRIT_SEC_HIF_LEAVE;
+        return M2M_ERR_FAIL;
+    }
+
+    if (!(u32Reg & NBIT0))
+    {
+        WINC_LOG_ERROR("False interrupt %" PRIx32, u32Reg);
+
+        WINC_CRIT_SEC_HIF_LEAVE;
+        return M2M_ERR_FAIL;
+    }
+
+    /* Drain messages the firmware posts back to back, up to the budget, so a
+     * burst of events is handled without waiting for a new interrupt each. */
+    while (1)
+    {
+        s8Ret = winc_hif_isr_message(u32Reg);
+
+        u8NumMsgs++;
+
+        if ((M2M_SUCCESS != s8Ret) || (u8NumMsgs >= CONF_WINC_HIF_ISR_BUDGET))
+        {
+            break;
+        }
+
+        WINC_CRIT_SEC_HIF_ENTER;
+
+        if ((WINC_BUS_SUCCESS != winc_bus_read_reg_with_ret(WIFI_HOST_RCV_CTRL_0, &u32Reg)) || !(u32Reg & NBIT0))
+        {
+            WINC_CRIT_SEC_HIF_LEAVE;
+            break;
+        }
+    }
+
+#ifdef CONF_WINC_HIF_STATS
+    gstrHifIsrStats.u32IsrCalls++;
+    gstrHifIsrStats.u32Messages += u8NumMsgs;
+
+    if (u8NumMsgs > gstrHifIsrStats.u32MaxBatch)
+    {
+        gstrHifIsrStats.u32MaxBatch = u8NumMsgs;
+    }
+
+    if ((M2M_SUCCESS == s8Ret) && (u8NumMsgs >= CONF_WINC_HIF_ISR_BUDGET))
+    {
+        gstrHifIsrStats.u32BudgetLimited++;
+    }
+#endif
+
+    if (winc_bus_error())
+    {
+        return M2M_ERR_FAIL;
+    }
+
+    return s8Ret;
+}
+
+#ifdef CONF_WINC_HIF_STATS
+void winc_hif_isr_stats_get(tstrHifIsrStats *pstrStats)
+{
+    if (NULL == pstrStats)
+    {
+        return;
+    }
+
+    WINC_CRIT_SEC_HIF_ENTER;
+    memcpy(pstrStats, &gstrHifIsrStats, sizeof(tstrHifIsrStats));
+    WINC_CRIT_SEC_HIF_LEAVE;
+}
+
+void winc_hif_isr_stats_reset(void)
+{
+    WINC_CRIT_SEC_HIF_ENTER;
+    memset(&gstrHifIsrStats, 0, sizeof(tstrHifIsrStats));
+    WINC_CRIT_SEC_HIF_LEAVE;
+}
+#endif
+
 int8_t winc_hif_receive(uint32_t u32Addr, const void *pvBuf, uint_fast16_t u16Sz)
 {
     if (u16Sz > gu16RxSize)
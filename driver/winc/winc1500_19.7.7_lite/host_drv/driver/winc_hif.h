@@ -53,6 +53,20 @@ typedef struct
     uint16_t    u16Length;  /*!< Payload length */
 } tstrHifHdr;
 
+#ifdef CONF_WINC_HIF_STATS
+/*!
+@struct     tstrHifIsrStats
+@brief      Interrupt handling statistics, collected when CONF_WINC_HIF_STATS is defined
+*/
+typedef struct
+{
+    uint32_t    u32IsrCalls;        /*!< Calls to winc_hif_handle_isr which handled a message */
+    uint32_t    u32Messages;        /*!< Messages handled across all calls */
+    uint32_t    u32MaxBatch;        /*!< Most messages handled in a single call */
+    uint32_t    u32BudgetLimited;   /*!< Calls which stopped at CONF_WINC_HIF_ISR_BUDGET */
+} tstrHifIsrStats;
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -168,10 +182,28 @@ void winc_hif_set_power_save(bool bPwrSave);
 @fn         winc_hif_handle_isr(void)
 @brief
             Handle interrupt received from WINC firmware.
+            Messages posted by the firmware while handling are processed in the same call,
+            up to CONF_WINC_HIF_ISR_BUDGET messages.
 @return
             The function returns 0 for success and a negative value otherwise.
 */
 int8_t winc_hif_handle_isr(void);
+#ifdef CONF_WINC_HIF_STATS
+/*!
+@fn         void winc_hif_isr_stats_get(tstrHifIsrStats *pstrStats);
+@brief
+            Retrieve the interrupt handling statistics.
+@param[out] pstrStats
+            Pointer to structure to receive the statistics.
+*/
+void winc_hif_isr_stats_get(tstrHifIsrStats *pstrStats);
+/*!
+@fn         void winc_hif_isr_stats_reset(void);
+@brief
+            Reset the interrupt handling statistics.
+*/
+void winc_hif_isr_stats_reset(void);
+#endif
 
 #ifdef __cplusplus
 }
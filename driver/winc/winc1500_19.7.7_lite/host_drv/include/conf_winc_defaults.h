@@ -114,6 +114,22 @@ void CONF_WINC_HIF_CB_SIGMA_HANDLER(uint8_t u8OpCode, uint16_t u16DataSize, uint
 #endif
 #endif
 
+#ifndef CONF_WINC_SPI_FLASH_READ_BURST_SZ
+#define CONF_WINC_SPI_FLASH_READ_BURST_SZ   (32UL * 1024)
+#endif
+
+#if (CONF_WINC_SPI_FLASH_READ_BURST_SZ == 0) || (CONF_WINC_SPI_FLASH_READ_BURST_SZ > 0xFFFF)
+#error SPI flash read burst size must be between 1 and 65535 bytes
+#endif
+
+#ifndef CONF_WINC_HIF_ISR_BUDGET
+#define CONF_WINC_HIF_ISR_BUDGET            8
+#endif
+
+#ifndef CONF_WINC_SB_STREAM_WINDOW
+#define CONF_WINC_SB_STREAM_WINDOW          8
+#endif
+
 #ifndef CONF_WINC_HIF_STRUCT_SIZE_CHECK
 #ifdef __GNUC__
 #define CONF_WINC_HIF_STRUCT_SIZE_CHECK(STRUCTNAME) _Static_assert((sizeof(STRUCTNAME)%4)==0, "Structure alignment error");
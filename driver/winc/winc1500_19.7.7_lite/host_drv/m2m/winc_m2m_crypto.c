@@ -114,6 +114,11 @@ MACROS
 #define SHA256_TARGET_HASH_H7                                   (SHA256_MEM_BASE+0x40)
 #define SHA256_TARGET_HASH_H8                                   (SHA256_MEM_BASE+0x44)
 
+/* Shared memory slots used by the streaming update, each followed by room
+ * for the hash write back so adjacent slots never overlap. */
+#define SHA256_STREAM_SLOT_SIZE                                 (1024)
+#define SHA256_STREAM_SLOT_ADDR(SLOT)                           (SHARED_MEM_BASE + ((SLOT) * (SHA256_STREAM_SLOT_SIZE + SHA_BLOCK_SIZE)))
+
 /*======*======*======*======*======*=======*
 * WINC BIGINT HW Engine Register Definition *
 *======*======*======*======*======*========*/
@@ -181,6 +186,9 @@ typedef struct
     uint8_t     au8CurrentBlock[64];
     uint32_t    u32TotalLength;
     uint8_t     u8InitHashFlag;
+    uint8_t     u8StreamSlot;
+    uint8_t     u8StreamBusy;
+    tpfSha256StreamCb pfStreamCb;
 } tstrSHA256HashCtxt;
 
 /*======*======*======*======*======*=======*
@@ -200,6 +208,55 @@ int8_t m2m_crypto_sha256_hash_init(tstrM2mSha256Ctxt *pstrSha256Ctxt)
     return 0;
 }
 
+static void sha256_engine_start(tstrSHA256HashCtxt *pstrSHA256, uint32_t u32Addr, uint32_t u32Length, uint32_t u32CtrlFlags)
+{
+    uint32_t u32RegVal = 0;
+
+    winc_bus_write_reg(SHA256_CTRL, u32RegVal);
+    u32RegVal |= SHA256_CTRL_FORCE_SHA256_QUIT_MASK;
+    winc_bus_write_reg(SHA256_CTRL, u32RegVal);
+
+    if (pstrSHA256->u8InitHashFlag)
+    {
+        pstrSHA256->u8InitHashFlag = 0;
+        u32RegVal |= SHA256_CTRL_INIT_SHA256_STATE_MASK;
+    }
+
+    winc_bus_write_reg(SHA256_DATA_LENGTH, u32Length);
+    winc_bus_write_reg(SHA256_START_RD_ADDR, u32Addr);
+    winc_bus_write_reg(SHA256_START_WR_ADDR, u32Addr + u32Length);
+
+    u32RegVal |= SHA256_CTRL_START_CALC_MASK;
+    u32RegVal |= u32CtrlFlags;
+
+    u32RegVal &= ~(0x7UL << 8);
+    u32RegVal |= (0x2UL << 8);
+
+    winc_bus_write_reg(SHA256_CTRL, u32RegVal);
+}
+
+static bool sha256_engine_is_done(void)
+{
+    return (winc_bus_read_reg(SHA256_DONE_INTR_STS) & NBIT0) ? true : false;
+}
+
+static void sha256_engine_wait(void)
+{
+    /* 5.   Wait for done_intr */
+    while (!sha256_engine_is_done())
+    {
+    }
+}
+
+static void sha256_stream_wait(tstrSHA256HashCtxt *pstrSHA256)
+{
+    if (pstrSHA256->u8StreamBusy)
+    {
+        sha256_engine_wait();
+        pstrSHA256->u8StreamBusy = 0;
+    }
+}
+
 int8_t m2m_crypto_sha256_hash_update(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t *pu8Data, uint16_t u16DataLength)
 {
     int8_t  s8Ret = M2M_ERR_FAIL;
@@ -207,14 +264,15 @@ int8_t m2m_crypto_sha256_hash_update(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t
 
     if (pstrSHA256 != NULL)
     {
-        uint32_t u32ReadAddr;
         uint32_t u32WriteAddr    = SHARED_MEM_BASE;
         uint32_t u32Addr         = u32WriteAddr;
         uint32_t u32ResidualBytes;
         uint32_t u32NBlocks;
         uint32_t u32Offset;
         uint32_t u32CurrentBlock = 0;
-        uint8_t  u8IsDone        = 0;
+
+        /* The engine and shared memory may still be in use by a streaming update. */
+        sha256_stream_wait(pstrSHA256);
 
         /* Get the remaining bytes from the previous update (if the length is not block aligned). */
         u32ResidualBytes = pstrSHA256->u32TotalLength % SHA_BLOCK_SIZE;
@@ -256,41 +314,82 @@ int8_t m2m_crypto_sha256_hash_update(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t
 
         if (u32NBlocks != 0)
         {
-            uint32_t u32RegVal = 0;
+            sha256_engine_start(pstrSHA256, u32WriteAddr, (u32NBlocks * SHA_BLOCK_SIZE), 0);
+            sha256_engine_wait();
+        }
 
-            winc_bus_write_reg(SHA256_CTRL, u32RegVal);
-            u32RegVal |= SHA256_CTRL_FORCE_SHA256_QUIT_MASK;
-            winc_bus_write_reg(SHA256_CTRL, u32RegVal);
+        if (u32ResidualBytes != 0)
+        {
+            memcpy(pstrSHA256->au8CurrentBlock, pu8Data, u32ResidualBytes);
+        }
 
-            if (pstrSHA256->u8InitHashFlag)
-            {
-                pstrSHA256->u8InitHashFlag = 0;
-                u32RegVal |= SHA256_CTRL_INIT_SHA256_STATE_MASK;
-            }
+        s8Ret = M2M_SUCCESS;
+    }
+
+    return s8Ret;
+}
+
+int8_t m2m_crypto_sha256_hash_stream_update(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t *pu8Data, uint16_t u16DataLength, tpfSha256StreamCb pfDoneCb)
+{
+    int8_t  s8Ret = M2M_ERR_FAIL;
+    tstrSHA256HashCtxt  *pstrSHA256 = (tstrSHA256HashCtxt *)pstrSha256Ctxt;
 
-            u32ReadAddr = u32WriteAddr + (u32NBlocks * SHA_BLOCK_SIZE);
-            winc_bus_write_reg(SHA256_DATA_LENGTH, (u32NBlocks * SHA_BLOCK_SIZE));
-            winc_bus_write_reg(SHA256_START_RD_ADDR, u32WriteAddr);
-            winc_bus_write_reg(SHA256_START_WR_ADDR, u32ReadAddr);
+    if ((pstrSHA256 != NULL) && ((pu8Data != NULL) || (u16DataLength == 0)))
+    {
+        uint32_t u32ResidualBytes;
+
+        pstrSHA256->pfStreamCb = pfDoneCb;
 
-            u32RegVal |= SHA256_CTRL_START_CALC_MASK;
+        /* Get the remaining bytes from the previous update (if the length is not block aligned). */
+        u32ResidualBytes = pstrSHA256->u32TotalLength % SHA_BLOCK_SIZE;
 
-            u32RegVal &= ~(0x7 << 8);
-            u32RegVal |= (2 << 8);
+        /* Update the total data length. */
+        pstrSHA256->u32TotalLength += u16DataLength;
+
+        while ((u32ResidualBytes + u16DataLength) >= SHA_BLOCK_SIZE)
+        {
+            uint32_t u32SlotAddr = SHA256_STREAM_SLOT_ADDR(pstrSHA256->u8StreamSlot);
+            uint32_t u32Length   = 0;
+            uint32_t u32Size;
+
+            /* Load the next slot while the engine digests the other one. */
+            if (u32ResidualBytes != 0)
+            {
+                u32Size = SHA_BLOCK_SIZE - u32ResidualBytes;
+                memcpy(&pstrSHA256->au8CurrentBlock[u32ResidualBytes], pu8Data, u32Size);
+                pu8Data         += u32Size;
+                u16DataLength   -= u32Size;
+
+                winc_bus_write_block(u32SlotAddr, pstrSHA256->au8CurrentBlock, SHA_BLOCK_SIZE);
+                u32Length        = SHA_BLOCK_SIZE;
+                u32ResidualBytes = 0;
+            }
 
-            winc_bus_write_reg(SHA256_CTRL, u32RegVal);
+            u32Size = (u16DataLength / SHA_BLOCK_SIZE) * SHA_BLOCK_SIZE;
+            if (u32Size > (SHA256_STREAM_SLOT_SIZE - u32Length))
+            {
+                u32Size = SHA256_STREAM_SLOT_SIZE - u32Length;
+            }
 
-            /* 5.   Wait for done_intr */
-            while (!u8IsDone)
+            if (u32Size != 0)
             {
-                u32RegVal = winc_bus_read_reg(SHA256_DONE_INTR_STS);
-                u8IsDone = u32RegVal & NBIT0;
+                winc_bus_write_block(u32SlotAddr + u32Length, pu8Data, (uint16_t)u32Size);
+                pu8Data         += u32Size;
+                u16DataLength   -= u32Size;
+                u32Length       += u32Size;
             }
+
+            /* Start on the new slot once the previous one has been consumed. */
+            sha256_stream_wait(pstrSHA256);
+            sha256_engine_start(pstrSHA256, u32SlotAddr, u32Length, 0);
+
+            pstrSHA256->u8StreamBusy = 1;
+            pstrSHA256->u8StreamSlot ^= 1;
         }
 
-        if (u32ResidualBytes != 0)
+        if (u16DataLength != 0)
         {
-            memcpy(pstrSHA256->au8CurrentBlock, pu8Data, u32ResidualBytes);
+            memcpy(&pstrSHA256->au8CurrentBlock[u32ResidualBytes], pu8Data, u16DataLength);
         }
 
         s8Ret = M2M_SUCCESS;
@@ -299,6 +398,33 @@ int8_t m2m_crypto_sha256_hash_update(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t
     return s8Ret;
 }
 
+int8_t m2m_crypto_sha256_hash_stream_poll(tstrM2mSha256Ctxt *pstrSha256Ctxt)
+{
+    tstrSHA256HashCtxt  *pstrSHA256 = (tstrSHA256HashCtxt *)pstrSha256Ctxt;
+
+    if (pstrSHA256 == NULL)
+    {
+        return M2M_ERR_INVALID_ARG;
+    }
+
+    if (pstrSHA256->u8StreamBusy)
+    {
+        if (!sha256_engine_is_done())
+        {
+            return 1;
+        }
+
+        pstrSHA256->u8StreamBusy = 0;
+
+        if (pstrSHA256->pfStreamCb != NULL)
+        {
+            pstrSHA256->pfStreamCb(pstrSha256Ctxt);
+        }
+    }
+
+    return M2M_SUCCESS;
+}
+
 int8_t m2m_crypto_sha256_hash_finish(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t *pu8Sha256Digest)
 {
     int8_t  s8Ret = M2M_ERR_FAIL;
@@ -312,20 +438,11 @@ int8_t m2m_crypto_sha256_hash_finish(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t
         uint16_t u16Offset;
         uint16_t u16PaddingLength;
         uint16_t u16NBlocks      = 1;
-        uint32_t u32RegVal       = 0;
         uint32_t u32Idx, u32ByteIdx;
         uint32_t au32Digest[M2M_SHA256_DIGEST_LEN / 4];
-        uint8_t  u8IsDone        = 0;
 
-        winc_bus_write_reg(SHA256_CTRL, u32RegVal);
-        u32RegVal |= SHA256_CTRL_FORCE_SHA256_QUIT_MASK;
-        winc_bus_write_reg(SHA256_CTRL, u32RegVal);
-
-        if (pstrSHA256->u8InitHashFlag)
-        {
-            pstrSHA256->u8InitHashFlag = 0;
-            u32RegVal |= SHA256_CTRL_INIT_SHA256_STATE_MASK;
-        }
+        /* The engine and shared memory may still be in use by a streaming update. */
+        sha256_stream_wait(pstrSHA256);
 
         /* Calculate the offset of the last data byte in the current block. */
         u16Offset = (uint16_t)(pstrSHA256->u32TotalLength % SHA_BLOCK_SIZE);
@@ -355,23 +472,9 @@ int8_t m2m_crypto_sha256_hash_finish(tstrM2mSha256Ctxt *pstrSha256Ctxt, uint8_t
 
         u32ReadAddr = u32WriteAddr + (u16NBlocks * SHA_BLOCK_SIZE);
         winc_bus_write_block(u32Addr, pstrSHA256->au8CurrentBlock, SHA_BLOCK_SIZE);
-        winc_bus_write_reg(SHA256_DATA_LENGTH, (u16NBlocks * SHA_BLOCK_SIZE));
-        winc_bus_write_reg(SHA256_START_RD_ADDR, u32WriteAddr);
-        winc_bus_write_reg(SHA256_START_WR_ADDR, u32ReadAddr);
-
-        u32RegVal |= SHA256_CTRL_START_CALC_MASK;
-        u32RegVal |= SHA256_CTRL_WR_BACK_HASH_VALUE_MASK;
-        u32RegVal &= ~(0x7UL << 8);
-        u32RegVal |= (0x2UL << 8);
-
-        winc_bus_write_reg(SHA256_CTRL, u32RegVal);
 
-        /* 5.   Wait for done_intr */
-        while (!u8IsDone)
-        {
-            u32RegVal = winc_bus_read_reg(SHA256_DONE_INTR_STS);
-            u8IsDone = u32RegVal & NBIT0;
-        }
+        sha256_engine_start(pstrSHA256, u32WriteAddr, (u16NBlocks * SHA_BLOCK_SIZE), SHA256_CTRL_WR_BACK_HASH_VALUE_MASK);
+        sha256_engine_wait();
 
         winc_bus_read_block(u32ReadAddr, (uint8_t *)au32Digest, 32);
 
@@ -85,6 +85,17 @@ typedef enum
             tenuM2mCryptoCmd
 */
 typedef void (*tpfAppCryproCb) (uint8_t u8MsgType, void *pvResp, void *pvMsg);
+/*!
+@typedef    tpfSha256StreamCb
+
+@brief      Callback notifying that the SHA256 engine has finished digesting all data
+            submitted through @ref m2m_crypto_sha256_hash_stream_update.
+@param[in]  pstrSha256Ctxt
+            Pointer to the SHA256 context the data was submitted to.
+@see
+            m2m_crypto_sha256_hash_stream_poll
+*/
+typedef void (*tpfSha256StreamCb) (tstrM2mSha256Ctxt *pstrSha256Ctxt);
 /*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
 FUNCTION PROTOTYPES
 *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*/
@@ -141,6 +152,58 @@ int8_t m2m_crypto_sha256_hash_init(tstrM2mSha256Ctxt *psha256Ctxt);
 */
 int8_t m2m_crypto_sha256_hash_update(tstrM2mSha256Ctxt *psha256Ctxt, uint8_t *pu8Data, uint16_t u16DataLength);
 
+#ifdef CONF_CRYPTO_HW
+/*!
+@fn         int8_t m2m_crypto_sha256_hash_stream_update(tstrM2mSha256Ctxt *psha256Ctxt, uint8_t *pu8Data, uint16_t u16DataLength, tpfSha256StreamCb pfDoneCb);
+
+@brief      SHA256 streaming hash update
+
+            Whole blocks are loaded into one of two shared memory slots while the SHA256 engine digests
+            the other, and the function returns as soon as the last slot has been started rather than
+            waiting for the engine. The data buffer may be reused as soon as the function returns.
+
+@param[in]  psha256Ctxt
+            Pointer to the SHA256 context.
+
+@param[in]  pu8Data
+            Buffer holding the data submitted to the hash.
+
+@param[in]  u16DataLength
+            Size of the data buffer in bytes.
+
+@param[in]  pfDoneCb
+            Optional callback called from @ref m2m_crypto_sha256_hash_stream_poll once the engine is idle.
+
+@pre        SHA256 module should be initialized first through m2m_crypto_sha256_hash_init function.
+
+@see        m2m_crypto_sha256_hash_init
+            m2m_crypto_sha256_hash_stream_poll
+
+@return
+            The function returns @ref M2M_SUCCESS for successful operation and a negative value otherwise.
+*/
+int8_t m2m_crypto_sha256_hash_stream_update(tstrM2mSha256Ctxt *psha256Ctxt, uint8_t *pu8Data, uint16_t u16DataLength, tpfSha256StreamCb pfDoneCb);
+
+/*!
+@fn         int8_t m2m_crypto_sha256_hash_stream_poll(tstrM2mSha256Ctxt *psha256Ctxt);
+
+@brief      Check for completion of a streaming hash update
+
+            Performs a single status read of the SHA256 engine. If the engine has finished the data
+            submitted by @ref m2m_crypto_sha256_hash_stream_update, the completion callback is called.
+
+@param[in]  psha256Ctxt
+            Pointer to the SHA256 context.
+
+@see        m2m_crypto_sha256_hash_stream_update
+
+@return
+            The function returns @ref M2M_SUCCESS if the engine is idle, a positive value while it is still
+            busy and a negative value on error.
+*/
+int8_t m2m_crypto_sha256_hash_stream_poll(tstrM2mSha256Ctxt *psha256Ctxt);
+#endif
+
 /*!
 @fn         int8_t m2m_crypto_sha256_hash_finish(tstrM2mSha256Ctxt *psha256Ctxt, uint8_t *pu8Sha256Digest);
 
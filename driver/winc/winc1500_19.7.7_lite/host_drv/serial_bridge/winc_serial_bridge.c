@@ -41,13 +41,34 @@ Microchip or any third party.
 #define SB_CMD_BUFFER_SIZE  128
 #define SB_HEADER_SIZE      12
 
+/* Streamed block transfers.
+ *
+ * The header carries the start address, the block size and the total length
+ * in place of the value. The host then sends (STREAM_WRITE) or receives
+ * (STREAM_READ) frames without waiting for a reply to each block:
+ *
+ *   STREAM_WRITE  host -> bridge  [seq][block]
+ *                 bridge -> host  [ACK][seq] after each window and the last block
+ *                                 [NACK][last good seq] on error, stream ends
+ *
+ *   STREAM_READ   bridge -> host  [ACK][seq][block], or [NACK][seq] on error
+ *                 host -> bridge  [ACK][seq] after each window to release the next
+ *
+ * Sequence numbers start at zero for each stream and wrap at 256.
+ */
+#define SB_STREAM_FRAME_HDR_SIZE    2
+#define SB_STREAM_BLOCK_MAX         (SB_CMD_BUFFER_SIZE - SB_STREAM_FRAME_HDR_SIZE)
+
 typedef enum
 {
     SERIAL_BRIDGE_STATE_UNKNOWN,
     SERIAL_BRIDGE_STATE_WAIT_OP_CODE,
     SERIAL_BRIDGE_STATE_WAIT_HEADER,
     SERIAL_BRIDGE_STATE_WAIT_PAYLOAD,
-    SERIAL_BRIDGE_STATE_PROCESS_COMMAND
+    SERIAL_BRIDGE_STATE_PROCESS_COMMAND,
+    SERIAL_BRIDGE_STATE_STREAM_WRITE,
+    SERIAL_BRIDGE_STATE_STREAM_READ,
+    SERIAL_BRIDGE_STATE_STREAM_WAIT_ACK
 } tenuState;
 
 typedef struct
@@ -60,6 +81,9 @@ typedef struct
     uint32_t        u32CmdAddr;
     uint32_t        u32CmdVal;
     uint_fast16_t   u16PayloadLen;
+    uint32_t        u32StreamRemain;
+    uint8_t         u8StreamSeq;
+    uint_fast8_t    u8StreamWinCnt;
 } tstrSBState;
 
 typedef enum
@@ -68,7 +92,9 @@ typedef enum
     SB_COMMAND_WRITE_REG         = 1,
     SB_COMMAND_READ_BLOCK        = 2,
     SB_COMMAND_WRITE_BLOCK       = 3,
-    SB_COMMAND_RECONFIGURE       = 5
+    SB_COMMAND_RECONFIGURE       = 5,
+    SB_COMMAND_STREAM_WRITE      = 6,
+    SB_COMMAND_STREAM_READ       = 7
 } tenuSBCommand;
 
 typedef enum
@@ -117,6 +143,15 @@ static bool sb_process_header(uint8_t *pau8Hdr)
             return false;
         }
     }
+    else if ((strSBState.u8CmdType == SB_COMMAND_STREAM_WRITE) || (strSBState.u8CmdType == SB_COMMAND_STREAM_READ))
+    {
+        strSBState.u16PayloadLen = 0;
+
+        if ((0 == strSBState.u16CmdSize) || (strSBState.u16CmdSize > SB_STREAM_BLOCK_MAX) || (0 == strSBState.u32CmdVal))
+        {
+            return false;
+        }
+    }
     else
     {
         strSBState.u16PayloadLen = 0;
@@ -172,6 +207,9 @@ static bool sb_process_command(void)
                 {
                     return false;
                 }
+
+                strSBState.u32CmdAddr += SB_CMD_BUFFER_SIZE;
+                u16Cnt -= SB_CMD_BUFFER_SIZE;
             }
 
             if (u16Cnt)
@@ -181,7 +219,7 @@ static bool sb_process_command(void)
                     return false;
                 }
 
-                if (strSBState.u16CmdSize != winc_bsp_uart_write(strSBState.au8DataBuf, strSBState.u16CmdSize))
+                if (u16Cnt != winc_bsp_uart_write(strSBState.au8DataBuf, u16Cnt))
                 {
                     return false;
                 }
@@ -227,6 +265,143 @@ static bool sb_process_command(void)
     return false;
 }
 
+static uint_fast16_t sb_stream_block_size(void)
+{
+    if (strSBState.u32StreamRemain < strSBState.u16CmdSize)
+    {
+        return (uint_fast16_t)strSBState.u32StreamRemain;
+    }
+
+    return strSBState.u16CmdSize;
+}
+
+static void sb_stream_send_rsp(uint8_t u8Rsp, uint8_t u8Seq)
+{
+    uint8_t au8Rsp[SB_STREAM_FRAME_HDR_SIZE];
+
+    au8Rsp[0] = u8Rsp;
+    au8Rsp[1] = u8Seq;
+
+    winc_bsp_uart_write(au8Rsp, SB_STREAM_FRAME_HDR_SIZE);
+}
+
+static void sb_stream_start(void)
+{
+    strSBState.u32StreamRemain = strSBState.u32CmdVal;
+    strSBState.u8StreamSeq     = 0;
+    strSBState.u8StreamWinCnt  = 0;
+    strSBState.u16RxDataLen    = 0;
+
+    if (strSBState.u8CmdType == SB_COMMAND_STREAM_WRITE)
+    {
+        strSBState.u16PayloadLen = 1 + sb_stream_block_size();
+        strSBState.enuState      = SERIAL_BRIDGE_STATE_STREAM_WRITE;
+    }
+    else
+    {
+        strSBState.enuState = SERIAL_BRIDGE_STATE_STREAM_READ;
+    }
+}
+
+static void sb_stream_write_process(void)
+{
+    uint_fast16_t u16BlkSz;
+
+    strSBState.u16RxDataLen += winc_bsp_uart_read(&strSBState.au8DataBuf[strSBState.u16RxDataLen], strSBState.u16PayloadLen - strSBState.u16RxDataLen);
+
+    if (strSBState.u16PayloadLen != strSBState.u16RxDataLen)
+    {
+        return;
+    }
+
+    u16BlkSz = strSBState.u16PayloadLen - 1;
+
+    if ((strSBState.au8DataBuf[0] != strSBState.u8StreamSeq) ||
+        (WINC_BUS_SUCCESS != winc_bus_write_block(strSBState.u32CmdAddr, &strSBState.au8DataBuf[1], u16BlkSz)))
+    {
+        /* The host resumes with a new stream after the last good block. */
+        sb_stream_send_rsp(SB_RESPONSE_NACK, strSBState.u8StreamSeq - 1);
+        strSBState.enuState = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+        return;
+    }
+
+    strSBState.u32CmdAddr      += u16BlkSz;
+    strSBState.u32StreamRemain -= u16BlkSz;
+    strSBState.u8StreamSeq++;
+    strSBState.u8StreamWinCnt++;
+
+    if ((0 == strSBState.u32StreamRemain) || (CONF_WINC_SB_STREAM_WINDOW == strSBState.u8StreamWinCnt))
+    {
+        sb_stream_send_rsp(SB_RESPONSE_ACK, strSBState.u8StreamSeq - 1);
+        strSBState.u8StreamWinCnt = 0;
+    }
+
+    if (0 == strSBState.u32StreamRemain)
+    {
+        strSBState.enuState = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+        return;
+    }
+
+    strSBState.u16RxDataLen  = 0;
+    strSBState.u16PayloadLen = 1 + sb_stream_block_size();
+}
+
+static void sb_stream_read_process(void)
+{
+    uint_fast16_t u16BlkSz = sb_stream_block_size();
+
+    strSBState.au8DataBuf[0] = SB_RESPONSE_ACK;
+    strSBState.au8DataBuf[1] = strSBState.u8StreamSeq;
+
+    if (WINC_BUS_SUCCESS != winc_bus_read_block(strSBState.u32CmdAddr, &strSBState.au8DataBuf[SB_STREAM_FRAME_HDR_SIZE], u16BlkSz))
+    {
+        sb_stream_send_rsp(SB_RESPONSE_NACK, strSBState.u8StreamSeq);
+        strSBState.enuState = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+        return;
+    }
+
+    if ((SB_STREAM_FRAME_HDR_SIZE + u16BlkSz) != winc_bsp_uart_write(strSBState.au8DataBuf, SB_STREAM_FRAME_HDR_SIZE + u16BlkSz))
+    {
+        strSBState.enuState = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+        return;
+    }
+
+    strSBState.u32CmdAddr      += u16BlkSz;
+    strSBState.u32StreamRemain -= u16BlkSz;
+    strSBState.u8StreamSeq++;
+    strSBState.u8StreamWinCnt++;
+
+    if (0 == strSBState.u32StreamRemain)
+    {
+        strSBState.enuState = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+    }
+    else if (CONF_WINC_SB_STREAM_WINDOW == strSBState.u8StreamWinCnt)
+    {
+        strSBState.u8StreamWinCnt = 0;
+        strSBState.u16RxDataLen   = 0;
+        strSBState.enuState       = SERIAL_BRIDGE_STATE_STREAM_WAIT_ACK;
+    }
+}
+
+static void sb_stream_wait_ack_process(void)
+{
+    strSBState.u16RxDataLen += winc_bsp_uart_read(&strSBState.au8DataBuf[strSBState.u16RxDataLen], SB_STREAM_FRAME_HDR_SIZE - strSBState.u16RxDataLen);
+
+    if (SB_STREAM_FRAME_HDR_SIZE != strSBState.u16RxDataLen)
+    {
+        return;
+    }
+
+    if ((SB_RESPONSE_ACK == strSBState.au8DataBuf[0]) && ((uint8_t)(strSBState.u8StreamSeq - 1) == strSBState.au8DataBuf[1]))
+    {
+        strSBState.enuState = SERIAL_BRIDGE_STATE_STREAM_READ;
+    }
+    else
+    {
+        strSBState.enuState = SERIAL_BRIDGE_STATE_WAIT_OP_CODE;
+    }
+}
+
 int_fast8_t winc_sb_init(uint32_t u32BaudRate)
 {
 #ifdef CONF_WINC_SB_SEND_UNSOL_SYNC_ID
@@ -319,7 +494,11 @@ void winc_sb_process(void)
                 u8Rsp = SB_RESPONSE_ACK;
                 winc_bsp_uart_write(&u8Rsp, 1);
 
-                if (strSBState.u16PayloadLen > 0)
+                if ((strSBState.u8CmdType == SB_COMMAND_STREAM_WRITE) || (strSBState.u8CmdType == SB_COMMAND_STREAM_READ))
+                {
+                    sb_stream_start();
+                }
+                else if (strSBState.u16PayloadLen > 0)
                 {
                     strSBState.enuState = SERIAL_BRIDGE_STATE_WAIT_PAYLOAD;
                     strSBState.u16RxDataLen = 0;
@@ -362,6 +541,24 @@ void winc_sb_process(void)
             break;
         }
 
+        case SERIAL_BRIDGE_STATE_STREAM_WRITE:
+        {
+            sb_stream_write_process();
+            break;
+        }
+
+        case SERIAL_BRIDGE_STATE_STREAM_READ:
+        {
+            sb_stream_read_process();
+            break;
+        }
+
+        case SERIAL_BRIDGE_STATE_STREAM_WAIT_ACK:
+        {
+            sb_stream_wait_ack_process();
+            break;
+        }
+
         default:
         {
             break;
@@ -37,53 +37,92 @@ Microchip or any third party.
 #include "winc_flexible_flash.h"
 
 #define FLASH_MAP_TABLE_ADDR        (FLASH_SECTOR_SZ+sizeof(tstrOtaControlSec)+8)
+#define FLASH_MAP_TABLE_SIZE        (4 + (N_ENTRIES_MAX * 8))
 #define N_ENTRIES_MAX               32
 
-int8_t spi_flexible_flash_find_section(uint16_t u16EntryIDToLookFor, uint32_t *pu32StartOffset, uint32_t *pu32Size)
+/* Host copy of the flash map table, loaded on first lookup. */
+typedef struct
 {
-    uint8_t au8buff[8];
-    uint8_t u8CurrEntry = 0;
-    uint8_t u8nEntries;
+    bool     bValid;
+    uint8_t  u8nEntries;
+    uint16_t au16ID[N_ENTRIES_MAX];
+    uint8_t  au8Sector[N_ENTRIES_MAX];
+    uint8_t  au8Size[N_ENTRIES_MAX];
+} tstrFlashMapCache;
 
-    if ((NULL == pu32StartOffset) || (NULL == pu32Size))
-    {
-        return M2M_ERR_INVALID_ARG;
-    }
+static tstrFlashMapCache gstrFlashMapCache;
+
+static int8_t spi_flexible_flash_load_table(void)
+{
+    uint8_t au8Table[FLASH_MAP_TABLE_SIZE];
+    uint8_t *pu8Entry;
+    uint8_t u8nEntries;
+    uint_fast8_t i;
 
-    if (M2M_SUCCESS != spi_flash_read(&au8buff[0], FLASH_MAP_TABLE_ADDR, 4))
+    /* Read the entry count and every entry slot in a single transfer. */
+    if (M2M_SUCCESS != spi_flash_read(au8Table, FLASH_MAP_TABLE_ADDR, sizeof(au8Table)))
     {
         return M2M_ERR_FAIL;
     }
 
-    u8nEntries = au8buff[0];     // Max number is 32, reading one byte will suffice
+    u8nEntries = au8Table[0];     // Max number is 32, reading one byte will suffice
 
     if (u8nEntries > N_ENTRIES_MAX)
     {
         return M2M_ERR_FAIL;
     }
 
-    while (u8nEntries > u8CurrEntry)
+    pu8Entry = &au8Table[4];
+
+    for (i = 0; i < u8nEntries; i++)
     {
-        uint16_t u16EntryID;
+        gstrFlashMapCache.au16ID[i]    = (uint16_t)((pu8Entry[1] << 8) | pu8Entry[0]);
+        gstrFlashMapCache.au8Sector[i] = pu8Entry[2];
+        gstrFlashMapCache.au8Size[i]   = pu8Entry[3];
 
-        if (M2M_SUCCESS != spi_flash_read(&au8buff[0], FLASH_MAP_TABLE_ADDR + 4 + (u8CurrEntry * 8), 8))
-        {
-            return M2M_ERR_FAIL;
-        }
+        pu8Entry += 8;
+    }
 
-        u8CurrEntry++;
+    gstrFlashMapCache.u8nEntries = u8nEntries;
+    gstrFlashMapCache.bValid     = true;
 
-        u16EntryID = (uint16_t)((au8buff[1] << 8) | au8buff[0]);
+    return M2M_SUCCESS;
+}
 
-        if (u16EntryID != u16EntryIDToLookFor)
+int8_t spi_flexible_flash_find_section(uint16_t u16EntryIDToLookFor, uint32_t *pu32StartOffset, uint32_t *pu32Size)
+{
+    uint_fast8_t i;
+
+    if ((NULL == pu32StartOffset) || (NULL == pu32Size))
+    {
+        return M2M_ERR_INVALID_ARG;
+    }
+
+    if ((false == gstrFlashMapCache.bValid) && (M2M_SUCCESS != spi_flexible_flash_load_table()))
+    {
+        return M2M_ERR_FAIL;
+    }
+
+    for (i = 0; i < gstrFlashMapCache.u8nEntries; i++)
+    {
+        if (gstrFlashMapCache.au16ID[i] != u16EntryIDToLookFor)
         {
             continue;
         }
 
-        *pu32StartOffset = au8buff[2] * FLASH_SECTOR_SZ;
-        *pu32Size        = au8buff[3] * FLASH_SECTOR_SZ;
+        *pu32StartOffset = gstrFlashMapCache.au8Sector[i] * FLASH_SECTOR_SZ;
+        *pu32Size        = gstrFlashMapCache.au8Size[i] * FLASH_SECTOR_SZ;
         break;
     }
 
     return M2M_SUCCESS;
-}
\ No newline at end of file
+}
+
+void spi_flexible_flash_invalidate(uint32_t u32Offset, uint32_t u32Sz)
+{
+    if ((u32Offset < (FLASH_MAP_TABLE_ADDR + FLASH_MAP_TABLE_SIZE)) &&
+        ((u32Offset + u32Sz) > FLASH_MAP_TABLE_ADDR))
+    {
+        gstrFlashMapCache.bValid = false;
+    }
+}
@@ -82,4 +82,22 @@ typedef struct
 int8_t spi_flexible_flash_find_section(uint16_t u16EntryIDToLookFor, uint32_t *pu32StartOffset, uint32_t *pu32Size);
 /**@}*/
 
+/** @defgroup SPiFlashInvalidate spi_flexible_flash_invalidate
+ *  @ingroup SPIFLASHAPI
+ */
+/**@{*/
+/*!
+@fn         void spi_flexible_flash_invalidate(uint32_t u32Offset, uint32_t u32Sz);
+@brief      Discard the cached Flash Map if a flash region overlaps it.\n
+            The Flash Map is read once and then held by the host, it is reloaded on the next
+            lookup after the table is erased or written by the host or by the WINC firmware.
+@param[in]  u32Offset
+            Start offset of the modified flash region.
+@param[in]  u32Sz
+            Size of the modified flash region, pass 0xFFFFFFFF with an offset of 0 to always discard.
+@return     None.
+*/
+void spi_flexible_flash_invalidate(uint32_t u32Offset, uint32_t u32Sz);
+/**@}*/
+
 #endif /* __FLEXIBLE_FLASH_H__ */
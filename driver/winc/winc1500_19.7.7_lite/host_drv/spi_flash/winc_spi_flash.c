@@ -37,6 +37,7 @@ Microchip or any third party.
 #include "driver/winc_asic.h"
 #include "winc_spi_flash.h"
 #include "winc_spi_flash_map.h"
+#include "winc_flexible_flash.h"
 
 #define HOST_SHARE_MEM_BASE     (0xd0000UL)
 /***********************************************************
@@ -227,7 +228,7 @@ static int8_t spi_flash_page_program(uint32_t u32MemAdr, uint32_t u32FlashAdr, u
 
 static int8_t spi_flash_read_internal(uint8_t *pu8Buf, uint32_t u32Addr, uint32_t u32Sz)
 {
-    /* read size must be < 64KB */
+    /* read size must be <= CONF_WINC_SPI_FLASH_READ_BURST_SZ */
     if (M2M_SUCCESS != spi_flash_load_to_cortus_mem(HOST_SHARE_MEM_BASE, u32Addr, u32Sz))
     {
         return M2M_ERR_FAIL;
@@ -241,37 +242,43 @@ static int8_t spi_flash_read_internal(uint8_t *pu8Buf, uint32_t u32Addr, uint32_
     return M2M_SUCCESS;
 }
 
-static int8_t spi_flash_pp(uint32_t u32Offset, uint8_t *pu8Buf, uint_fast16_t u16Sz)
+static bool spi_flash_is_erased(const uint8_t *pu8Buf, uint32_t u32Sz)
 {
-    uint8_t u8Reg;
-
-    /* use shared packet memory as temp mem */
-    if (WINC_BUS_SUCCESS != winc_bus_write_block(HOST_SHARE_MEM_BASE, pu8Buf, u16Sz))
+    while (u32Sz--)
     {
-        return M2M_ERR_FAIL;
+        if (*pu8Buf++ != 0xff)
+        {
+            return false;
+        }
     }
 
-    spi_flash_write_enable();
-    spi_flash_page_program(HOST_SHARE_MEM_BASE, u32Offset, u16Sz);
-    spi_flash_read_status_reg(&u8Reg);
+    return true;
+}
+
+static int8_t spi_flash_wait_idle(void)
+{
+    uint8_t u8Reg;
 
     do
     {
         if (M2M_SUCCESS != spi_flash_read_status_reg(&u8Reg))
         {
-            break;
+            return M2M_ERR_FAIL;
         }
     }
     while (u8Reg & 0x01);
 
-    spi_flash_write_disable();
+    return M2M_SUCCESS;
+}
 
-    if (winc_bus_error())
+static int8_t spi_flash_pp_start(uint32_t u32MemAdr, uint32_t u32Offset, uint_fast16_t u16Sz)
+{
+    if (M2M_SUCCESS != spi_flash_write_enable())
     {
         return M2M_ERR_FAIL;
     }
 
-    return M2M_SUCCESS;
+    return spi_flash_page_program(u32MemAdr, u32Offset, u16Sz);
 }
 
 static uint32_t spi_flash_rdid(void)
@@ -371,29 +378,103 @@ int8_t spi_flash_enable(uint8_t enable)
 
 int8_t spi_flash_read(uint8_t *pu8Buf, uint32_t u32offset, uint32_t u32Sz)
 {
-    if (u32Sz > FLASH_PAGE_SZ)
+    if (u32Sz > CONF_WINC_SPI_FLASH_READ_BURST_SZ)
     {
         do
         {
-            if (M2M_SUCCESS != spi_flash_read_internal(pu8Buf, u32offset, FLASH_PAGE_SZ))
+            if (M2M_SUCCESS != spi_flash_read_internal(pu8Buf, u32offset, CONF_WINC_SPI_FLASH_READ_BURST_SZ))
             {
                 return M2M_ERR_FAIL;
             }
 
-            u32Sz     -= FLASH_PAGE_SZ;
-            u32offset += FLASH_PAGE_SZ;
-            pu8Buf    += FLASH_PAGE_SZ;
+            u32Sz     -= CONF_WINC_SPI_FLASH_READ_BURST_SZ;
+            u32offset += CONF_WINC_SPI_FLASH_READ_BURST_SZ;
+            pu8Buf    += CONF_WINC_SPI_FLASH_READ_BURST_SZ;
         }
-        while (u32Sz > FLASH_PAGE_SZ);
+        while (u32Sz > CONF_WINC_SPI_FLASH_READ_BURST_SZ);
     }
 
     return spi_flash_read_internal(pu8Buf, u32offset, u32Sz);
 }
 
+int8_t spi_flash_read_stream(uint32_t u32Offset, uint32_t u32Sz, uint8_t *pu8Buf, uint32_t u32BufSz, tpfSpiFlashReadCb pfReadCb, void *pvCtx)
+{
+    int8_t s8Ret = M2M_SUCCESS;
+    uint8_t *pu8Bounce = pu8Buf;
+
+    if (NULL == pfReadCb)
+    {
+        return M2M_ERR_INVALID_ARG;
+    }
+
+    if (0 == u32Sz)
+    {
+        /* Read to the end of the flash, the size is reported in megabits. */
+        uint32_t u32FlashSz = spi_flash_get_size() << 17;
+
+        if (u32Offset >= u32FlashSz)
+        {
+            return M2M_ERR_INVALID_ARG;
+        }
+
+        u32Sz = u32FlashSz - u32Offset;
+    }
+
+    if (NULL == pu8Bounce)
+    {
+#ifdef CONF_WINC_LARGE_MEMORY_ALLOC_STYLE_DYNAMIC
+        u32BufSz  = CONF_WINC_SPI_FLASH_READ_BURST_SZ;
+        pu8Bounce = (uint8_t*)CONF_WINC_LARGE_MEMORY_ALLOC_FUNC(u32BufSz);
+
+        if (NULL == pu8Bounce)
+        {
+            return M2M_ERR_MEM_ALLOC;
+        }
+#else
+        return M2M_ERR_INVALID_ARG;
+#endif
+    }
+
+    if (u32BufSz > CONF_WINC_SPI_FLASH_READ_BURST_SZ)
+    {
+        u32BufSz = CONF_WINC_SPI_FLASH_READ_BURST_SZ;
+    }
+
+    if (0 == u32BufSz)
+    {
+        s8Ret = M2M_ERR_INVALID_ARG;
+    }
+
+    while ((M2M_SUCCESS == s8Ret) && (u32Sz > 0))
+    {
+        uint32_t u32ReadSz = (u32Sz > u32BufSz) ? u32BufSz : u32Sz;
+
+        s8Ret = spi_flash_read_internal(pu8Bounce, u32Offset, u32ReadSz);
+
+        if (M2M_SUCCESS == s8Ret)
+        {
+            s8Ret = pfReadCb(pvCtx, u32Offset, pu8Bounce, u32ReadSz);
+        }
+
+        u32Offset += u32ReadSz;
+        u32Sz     -= u32ReadSz;
+    }
+
+#ifdef CONF_WINC_LARGE_MEMORY_ALLOC_STYLE_DYNAMIC
+    if (NULL == pu8Buf)
+    {
+        CONF_WINC_LARGE_MEMORY_FREE_FUNC(pu8Bounce);
+    }
+#endif
+
+    return s8Ret;
+}
+
 int8_t spi_flash_write(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
 {
     uint_fast16_t u16wsz;
-    uint32_t u32off;
+    uint_fast8_t u8Slot = 0;
+    bool bBusy = false;
 
     if (u32Sz == 0)
     {
@@ -401,12 +482,14 @@ int8_t spi_flash_write(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
         return M2M_ERR_FAIL;
     }
 
-    u32off = u32Offset % FLASH_PAGE_SZ;
+    spi_flexible_flash_invalidate(u32Offset, u32Sz);
 
-    if (u32off)     /*first part of data in the address page*/
+    /* Pages are staged alternately in two shared memory slots, the next page
+     * is loaded while the flash is still busy programming the previous one. */
+    while (u32Sz > 0)
     {
-        // Calculate remaining space in this sector
-        u16wsz = (uint_fast16_t)(FLASH_PAGE_SZ - u32off);
+        // Calculate remaining space in this page, the first page may be partial
+        u16wsz = (uint_fast16_t)(FLASH_PAGE_SZ - (u32Offset % FLASH_PAGE_SZ));
 
         // Cap write to the requested size if smaller
         if (u16wsz > u32Sz)
@@ -414,9 +497,28 @@ int8_t spi_flash_write(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
             u16wsz = (uint_fast16_t)u32Sz;
         }
 
-        if (spi_flash_pp(u32Offset, pu8Buf, u16wsz) != M2M_SUCCESS)
+        /* Programming 0xFF leaves the flash unchanged, so skip it. */
+        if (false == spi_flash_is_erased(pu8Buf, u16wsz))
         {
-            return M2M_ERR_FAIL;
+            uint32_t u32MemAdr = HOST_SHARE_MEM_BASE + (u8Slot * FLASH_PAGE_SZ);
+
+            if (WINC_BUS_SUCCESS != winc_bus_write_block(u32MemAdr, pu8Buf, u16wsz))
+            {
+                return M2M_ERR_FAIL;
+            }
+
+            if ((true == bBusy) && (M2M_SUCCESS != spi_flash_wait_idle()))
+            {
+                return M2M_ERR_FAIL;
+            }
+
+            if (M2M_SUCCESS != spi_flash_pp_start(u32MemAdr, u32Offset, u16wsz))
+            {
+                return M2M_ERR_FAIL;
+            }
+
+            bBusy  = true;
+            u8Slot ^= 1;
         }
 
         pu8Buf    += u16wsz;
@@ -424,26 +526,18 @@ int8_t spi_flash_write(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
         u32Sz     -= u16wsz;
     }
 
-    while (u32Sz > 0)
+    if ((true == bBusy) && (M2M_SUCCESS != spi_flash_wait_idle()))
     {
-        if (u32Sz >= FLASH_PAGE_SZ)
-        {
-            u16wsz = FLASH_PAGE_SZ;
-        }
-        else
-        {
-            u16wsz = (uint_fast16_t)u32Sz;
-        }
+        return M2M_ERR_FAIL;
+    }
 
-        /*write complete page or the remaining data*/
-        if (spi_flash_pp(u32Offset, pu8Buf, u16wsz) != M2M_SUCCESS)
-        {
-            return M2M_ERR_FAIL;
-        }
+    /* The write enable latch clears at the end of each page program, this
+     * only guards against a page program which was not accepted. */
+    spi_flash_write_disable();
 
-        pu8Buf    += u16wsz;
-        u32Offset += u16wsz;
-        u32Sz     -= u16wsz;
+    if (winc_bus_error())
+    {
+        return M2M_ERR_FAIL;
     }
 
     return M2M_SUCCESS;
@@ -453,9 +547,24 @@ int8_t spi_flash_erase(uint32_t u32Offset, uint32_t u32Sz)
 {
     uint32_t i;
     uint8_t u8Reg;
+    uint32_t u32Start;
+    uint32_t u32End;
+
+    /* Reject ranges which wrap, allowing for rounding up to a whole sector. */
+    if ((u32Offset > (UINT32_MAX - FLASH_SECTOR_SZ)) || (u32Sz > ((UINT32_MAX - FLASH_SECTOR_SZ) - u32Offset)))
+    {
+        WINC_LOG_ERROR("Invalid erase region %" PRIx32 " %" PRIu32, u32Offset, u32Sz);
+        return M2M_ERR_INVALID_ARG;
+    }
 
     WINC_LOG_INFO("\r\n>Start erasing...");
 
+    /* Sector erase clears every whole sector touched by the range. */
+    u32Start = u32Offset & ~(FLASH_SECTOR_SZ - 1);
+    u32End   = (u32Offset + u32Sz + FLASH_SECTOR_SZ - 1) & ~(FLASH_SECTOR_SZ - 1);
+
+    spi_flexible_flash_invalidate(u32Start, u32End - u32Start);
+
     for (i = u32Offset; i < (u32Sz + u32Offset); i += (16 * FLASH_PAGE_SZ))
     {
         if (M2M_SUCCESS != spi_flash_write_enable())
@@ -493,6 +602,86 @@ int8_t spi_flash_erase(uint32_t u32Offset, uint32_t u32Sz)
     return M2M_SUCCESS;
 }
 
+int8_t spi_flash_update(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz)
+{
+    uint8_t au8Page[FLASH_PAGE_SZ];
+
+    if ((NULL == pu8Buf) || (0 == u32Sz) || (0 != (u32Offset % FLASH_SECTOR_SZ)))
+    {
+        WINC_LOG_ERROR("Invalid update region %" PRIx32 " %" PRIu32, u32Offset, u32Sz);
+        return M2M_ERR_INVALID_ARG;
+    }
+
+    while (u32Sz > 0)
+    {
+        uint32_t u32SectorSz = (u32Sz > FLASH_SECTOR_SZ) ? FLASH_SECTOR_SZ : u32Sz;
+        uint32_t u32Pos;
+        bool bChanged = false;
+
+        /* Compare the sector with the new data a page at a time. */
+        for (u32Pos = 0; u32Pos < u32SectorSz; u32Pos += FLASH_PAGE_SZ)
+        {
+            uint32_t u32PageSz = u32SectorSz - u32Pos;
+
+            if (u32PageSz > FLASH_PAGE_SZ)
+            {
+                u32PageSz = FLASH_PAGE_SZ;
+            }
+
+            if (M2M_SUCCESS != spi_flash_read_internal(au8Page, u32Offset + u32Pos, u32PageSz))
+            {
+                return M2M_ERR_FAIL;
+            }
+
+            if (0 != memcmp(au8Page, &pu8Buf[u32Pos], u32PageSz))
+            {
+                bChanged = true;
+                break;
+            }
+        }
+
+        /* Erasing the range clears the tail of a partial last sector, so it must be erased too. */
+        for (u32Pos = u32SectorSz; (false == bChanged) && (u32Pos < FLASH_SECTOR_SZ); u32Pos += FLASH_PAGE_SZ)
+        {
+            uint32_t u32PageSz = FLASH_SECTOR_SZ - u32Pos;
+
+            if (u32PageSz > FLASH_PAGE_SZ)
+            {
+                u32PageSz = FLASH_PAGE_SZ;
+            }
+
+            if (M2M_SUCCESS != spi_flash_read_internal(au8Page, u32Offset + u32Pos, u32PageSz))
+            {
+                return M2M_ERR_FAIL;
+            }
+
+            if (false == spi_flash_is_erased(au8Page, u32PageSz))
+            {
+                bChanged = true;
+            }
+        }
+
+        if (true == bChanged)
+        {
+            if (M2M_SUCCESS != spi_flash_erase(u32Offset, FLASH_SECTOR_SZ))
+            {
+                return M2M_ERR_FAIL;
+            }
+
+            if (M2M_SUCCESS != spi_flash_write(pu8Buf, u32Offset, u32SectorSz))
+            {
+                return M2M_ERR_FAIL;
+            }
+        }
+
+        pu8Buf    += u32SectorSz;
+        u32Offset += u32SectorSz;
+        u32Sz     -= u32SectorSz;
+    }
+
+    return M2M_SUCCESS;
+}
+
 uint32_t spi_flash_get_size(void)
 {
     uint32_t u32FlashId;
@@ -102,6 +102,69 @@ uint32_t spi_flash_get_size(void);
 */
 int8_t spi_flash_read(uint8_t *pu8Buf, uint32_t u32Addr, uint32_t u32Sz);
 
+/*!
+@typedef    tpfSpiFlashReadCb
+
+@brief      Callback receiving each block of data read by @ref spi_flash_read_stream.
+
+@param[in]  pvCtx
+            Context pointer passed to @ref spi_flash_read_stream.
+
+@param[in]  u32Offset
+            Address offset within the SPI flash of the block.
+
+@param[in]  pu8Buf
+            Pointer to the block data.
+
+@param[in]  u32Sz
+            Size of the block (in bytes).
+
+@return
+            @ref M2M_SUCCESS to continue reading, any other value stops the read and is returned
+            by @ref spi_flash_read_stream.
+*/
+typedef int8_t (*tpfSpiFlashReadCb)(void *pvCtx, uint32_t u32Offset, const uint8_t *pu8Buf, uint32_t u32Sz);
+
+/*!
+@fn         int8_t spi_flash_read_stream(uint32_t u32Offset, uint32_t u32Sz, uint8_t *pu8Buf, uint32_t u32BufSz, tpfSpiFlashReadCb pfReadCb, void *pvCtx);
+
+@brief
+            Read a range of the SPI flash in large bursts, passing each block to a callback.
+
+@param[in]  u32Offset
+            Address offset within the SPI flash to read the data from.
+
+@param[in]  u32Sz
+            Total size of data to be read (in bytes), zero reads to the end of the flash.
+
+@param[in]  pu8Buf
+            Bounce buffer each block is read into. If NULL and the dynamic large memory
+            allocation style is configured a buffer is allocated for the duration of the read.
+
+@param[in]  u32BufSz
+            Size of the bounce buffer, blocks are limited to CONF_WINC_SPI_FLASH_READ_BURST_SZ.
+
+@param[in]  pfReadCb
+            Callback receiving each block.
+
+@param[in]  pvCtx
+            Context pointer passed to the callback.
+
+@note
+            No firmware is required to be loaded on the WINC for the SPI flash to be accessed.
+
+@warning
+            If the WINC device has running firmware it must be stopped before interacting with
+            the SPI flash using @ref m2m_wifi_download_mode.
+
+@see        m2m_wifi_download_mode
+@see        spi_flash_read
+
+@return
+            The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+*/
+int8_t spi_flash_read_stream(uint32_t u32Offset, uint32_t u32Sz, uint8_t *pu8Buf, uint32_t u32BufSz, tpfSpiFlashReadCb pfReadCb, void *pvCtx);
+
 /*!
 @fn         int8_t spi_flash_write(uint8_t* pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
 
@@ -172,6 +235,42 @@ int8_t spi_flash_write(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
             The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
 */
 int8_t spi_flash_erase(uint32_t u32Offset, uint32_t u32Sz);
+
+/*!
+@fn         int8_t spi_flash_update(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
+
+@brief      Reprogram a range of the SPI flash, erasing and writing only the sectors which differ.
+
+@param[in]  pu8Buf
+            Pointer to a data buffer containing the new contents of the range.
+
+@param[in]  u32Offset
+            Address offset within the SPI flash of the range, must be aligned with a sector boundary.
+
+@param[in]  u32Sz
+            Total size of the range (in bytes).
+
+@note
+            Each sector is read back and compared with the new data. Sectors which already hold the
+            new data are left untouched, other sectors are erased and written. This has the same
+            result as @ref spi_flash_erase followed by @ref spi_flash_write over the same range.
+
+@note
+            If the range ends part way through a sector, the remainder of that sector is erased
+            unless it is already erased and the data matches, as with @ref spi_flash_erase.
+
+@warning
+            If the WINC device has running firmware it must be stopped before interacting with
+            the SPI flash using @ref m2m_wifi_download_mode.
+
+@see        m2m_wifi_download_mode
+@see        spi_flash_erase
+@see        spi_flash_write
+
+@return
+            The function returns @ref M2M_SUCCESS for successful operations and a negative value otherwise.
+*/
+int8_t spi_flash_update(uint8_t *pu8Buf, uint32_t u32Offset, uint32_t u32Sz);
 /**@}*/
 
 #endif  //__SPI_FLASH_H__
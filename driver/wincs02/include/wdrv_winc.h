@@ -139,6 +139,16 @@ Microchip or any third party.
 /* Number of file contexts. */
 #define WDRV_WINC_FILE_CTX_NUM          1U
 
+/* Number of MQTT publishes which may be in flight. */
+#ifndef WDRV_WINC_MQTT_PUB_NUM
+#define WDRV_WINC_MQTT_PUB_NUM          4U
+#endif
+
+/* Maximum number of messages in one MQTT publish batch. */
+#ifndef WDRV_WINC_MQTT_PUB_BATCH_NUM
+#define WDRV_WINC_MQTT_PUB_BATCH_NUM    16U
+#endif
+
 // *****************************************************************************
 /* L2 Data Frame Monitor Callback Function Pointer
 
@@ -344,6 +354,9 @@ typedef struct
     /* Variable to store the state of the connection. */
     WDRV_WINC_CONN_STATE connectedState;
 
+    /* Flag indicating a directed fast reconnect is in progress. */
+    bool fastReconnect;
+
     /* Flag indicating if a BSS scan is currently in progress. */
     bool scanInProgress;
 
@@ -399,6 +412,9 @@ typedef struct
     /* TLS context information */
     WDRV_WINC_TLSCTX_INFO tlscInfo[WDRV_WINC_TLS_CTX_NUM];
 
+    /* External crypto signing queue. */
+    WDRV_WINC_EXTCRYPTO_SIGN_QUEUE extCryptoSignQueue;
+
     struct
     {
         /* TLS cipher suite information */
@@ -461,11 +477,19 @@ typedef struct
         /* User context for MQTT connection status callback. */
         uintptr_t connCbCtx;
 
-        /* Publish status callback function pointer. */
-        WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb;
+        /* Table of in flight publish messages. */
+        WDRV_WINC_MQTT_PUB_ENTRY pubTable[WDRV_WINC_MQTT_PUB_NUM];
 
-        /* Publish status callback user context. */
-        uintptr_t pubStatusCbCtx;
+        /* Acknowledgements received before their packet ID was reported. */
+        WDRV_WINC_MQTT_PUB_EARLY_ACK pubEarlyAck[WDRV_WINC_MQTT_PUB_NUM];
+
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+        /* Table of driver managed topic aliases. */
+        WDRV_WINC_MQTT_TOPIC_ALIAS_ENTRY topicAliasTable[WDRV_WINC_MQTT_TOPIC_ALIAS_NUM];
+
+        /* Topic alias usage counter. */
+        uint32_t topicAliasUseCount;
+#endif
 
         /* Subscribe callback function pointer. */
         WDRV_WINC_MQTT_SUBSCRIBE_CALLBACK pfSubscribeCb;
@@ -493,6 +517,9 @@ typedef struct
     /* Callback to use for events relating to the WINC system time. */
     WDRV_WINC_SYSTIME_CURRENT_CALLBACK pfSystemTimeGetCurrentCB;
 
+    /* Host maintained copy of the WINC system time. */
+    WDRV_WINC_SYSTIME_HOST_CLOCK sysTimeHostClock;
+
     /* Callback to use for retrieving association RSSI information from the WINC. */
     WDRV_WINC_ASSOC_RSSI_CALLBACK pfAssociationRSSICB;
 
@@ -510,6 +537,10 @@ typedef struct
 
     /* Callback to use for DNS resolve responses. */
     WDRV_WINC_DNS_RESOLVE_CALLBACK pfDNSResolveResponseCB;
+#endif
+#ifndef WDRV_WINC_MOD_DISABLE_ICMP
+    /* Multi-target ping session. */
+    WDRV_WINC_PING_SESSION pingSession;
 #endif
     /* Callback to use for network interface events. */
     WDRV_WINC_NETIF_EVENT_HANDLER pfNetIfEventCB;
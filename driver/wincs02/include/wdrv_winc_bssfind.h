@@ -280,6 +280,35 @@ void WDRV_WINC_WSCNProcessAEC
     const WINC_DEV_EVENT_RSP_ELEMS *const pElems
 );
 
+//*******************************************************************************
+/*
+  Function:
+    void WDRV_WINC_BSSFindCacheReset(void)
+
+  Summary:
+    Empties the scan result cache.
+
+  Description:
+    Removes all entries from the scan result cache and clears its BSSID
+      hash index.
+
+  Precondition:
+    None.
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+  Remarks:
+    Called by the driver during initialisation and open, and before each new
+      scan is started.
+
+*/
+
+void WDRV_WINC_BSSFindCacheReset(void);
+
 //*******************************************************************************
 /*
   Function:
@@ -368,7 +397,8 @@ WDRV_WINC_STATUS WDRV_WINC_BSSFindFirst
     WDRV_WINC_STATUS_BSS_FIND_END     - No more results are available.
 
   Remarks:
-    None.
+    Results are returned in order of descending RSSI, each BSSID is only
+    reported once with the most recently received scan details.
 
 */
 
@@ -53,6 +53,20 @@ Microchip or any third party.
 
 #include "wdrv_winc_common.h"
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: WINC Driver External Crypto Defines
+// *****************************************************************************
+// *****************************************************************************
+
+/* Number of signing requests which can be held by the signing queue. */
+#ifndef WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM
+#define WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM      8U
+#endif
+
+/* Maximum length of a value to be signed held by the signing queue. */
+#define WDRV_WINC_EXTCRYPTO_SIGN_VALUE_MAX_LEN  66U
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver External Crypto Data Types
@@ -137,6 +151,81 @@ typedef void (*WDRV_WINC_EXTCRYPTO_SIGN_CB)
     uintptr_t extCryptoCxt
 );
 
+// *****************************************************************************
+/*  Signing Queue Entry
+
+  Summary:
+    Signing queue entry.
+
+  Description:
+    A signing request received from the WINC held by the signing queue.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Flag indicating if the entry is in use. */
+    bool inUse;
+
+    /* Flag indicating if the request has been passed to the signer. */
+    bool dispatched;
+
+    /* External crypto context of the request. */
+    uint16_t extCryptoCxt;
+
+    /* TLS context handle which the request originated from. */
+    uint8_t tlsHandle;
+
+    /* Length of value to be signed. */
+    uint8_t signValueLen;
+
+    /* Signature algorithm. */
+    WDRV_WINC_EXTCRYPTO_SIG_ALGO signAlgo;
+
+    /* Sequence number used to dispatch requests in order of arrival. */
+    uint32_t seqNum;
+
+    /* Value to be signed. */
+    uint8_t signValue[WDRV_WINC_EXTCRYPTO_SIGN_VALUE_MAX_LEN];
+} WDRV_WINC_EXTCRYPTO_SIGN_ENTRY;
+
+// *****************************************************************************
+/*  Signing Queue
+
+  Summary:
+    Signing queue state.
+
+  Description:
+    Holds signing requests received from the WINC and tracks those currently
+      being processed by the signer.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Signer, or NULL to use the TLS context signing callback. */
+    WDRV_WINC_EXTCRYPTO_SIGN_CB pfSignCB;
+
+    /* Maximum number of requests passed to the signer at once, 0 disables the queue. */
+    uint8_t maxOutstanding;
+
+    /* Number of requests currently with the signer. */
+    uint8_t numOutstanding;
+
+    /* Flag indicating if requests are being dispatched. */
+    bool dispatching;
+
+    /* Next sequence number to assign. */
+    uint32_t nextSeqNum;
+
+    /* Queue entries. */
+    WDRV_WINC_EXTCRYPTO_SIGN_ENTRY entries[WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM];
+} WDRV_WINC_EXTCRYPTO_SIGN_QUEUE;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver External Crypto Routines
@@ -221,7 +310,9 @@ void WDRV_WINC_EXTCRYPTOProcessAEC
     WDRV_WINC_STATUS_REQUEST_ERROR - The request to the WINC was rejected.
 
   Remarks:
-    None.
+    When the signing queue is enabled this also releases the request from the
+      queue, allowing the next queued request to be passed to the signer.
+      Results may be provided in any order.
 
 */
 
@@ -234,4 +325,56 @@ WDRV_WINC_STATUS WDRV_WINC_EXTCRYPTOSignResult
     size_t lenSignature
 );
 
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_EXTCRYPTOSignQueueConfigure
+    (
+        DRV_HANDLE handle,
+        WDRV_WINC_EXTCRYPTO_SIGN_CB pfSignCB,
+        uint8_t maxOutstanding
+    )
+
+  Summary:
+    Configures the external signing queue.
+
+  Description:
+    Enables queuing of signing requests received from the WINC. Up to
+      maxOutstanding requests are passed to the signer at once, further
+      requests are held and passed on in order of arrival as results are
+      provided.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle         - Client handle obtained by a call to WDRV_WINC_Open.
+    pfSignCB       - Signer to pass requests to, or NULL to use the signing
+                       callback of the originating TLS context.
+    maxOutstanding - Maximum number of requests passed to the signer at once,
+                       0 disables the queue.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The queue has been configured.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+    WDRV_WINC_STATUS_BUSY          - Requests are currently queued.
+
+  Remarks:
+    The signer is called with the signCbCtx of the originating TLS context.
+      The value to be signed remains valid until WDRV_WINC_EXTCRYPTOSignResult
+      is called for the request, so the signer may complete asynchronously.
+
+    If the queue is full a failure result is returned to the WINC.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_EXTCRYPTOSignQueueConfigure
+(
+    DRV_HANDLE handle,
+    WDRV_WINC_EXTCRYPTO_SIGN_CB pfSignCB,
+    uint8_t maxOutstanding
+);
+
 #endif /* WDRV_WINC_EXTCRYPTO_H */
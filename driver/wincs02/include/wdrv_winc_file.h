@@ -62,6 +62,11 @@ Microchip or any third party.
 
 #define WDRV_WINC_FILE_LOAD_BUF_SZ                      128U
 
+/* Maximum number of FSTSFR blocks which may be awaiting acknowledgement. */
+#ifndef WDRV_WINC_FILE_TSFR_WINDOW
+#define WDRV_WINC_FILE_TSFR_WINDOW                      4U
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver File Operation Data Types
@@ -354,9 +359,18 @@ typedef struct
         /* FS=LOAD operation. */
         struct
         {
-            /* Last known block number. */
+            /* Last block number sent. */
             uint8_t blockNum;
 
+            /* Last block number acknowledged by the WINC. */
+            uint8_t ackBlockNum;
+
+            /* Last block number carrying data from the current write. */
+            uint8_t writeBlockNum;
+
+            /* Flag indicating a write is awaiting completion. */
+            bool writePending;
+
             /* Pointer to user supplied data buffer. */
             const uint8_t *pData;
 
@@ -508,7 +522,13 @@ WDRV_WINC_STATUS WDRV_WINC_FileClose
     WDRV_WINC_STATUS_BUSY           - Transfer is busy
 
   Remarks:
-    None.
+    Whole blocks of WDRV_WINC_FILE_LOAD_BUF_SZ bytes are sent directly from
+    the user buffer, up to WDRV_WINC_FILE_TSFR_WINDOW blocks may be in flight
+    at once. The user buffer must remain valid until the
+    WDRV_WINC_FILE_STATUS_WRITE_COMPLETE status is received, this is reported
+    once per write when the last block holding its data is acknowledged. A
+    short write held in the internal buffer may complete before this
+    function returns.
 
 */
 
@@ -69,6 +69,16 @@ Microchip or any third party.
 /* Defines the maximum length of the assigned client ID. */
 #define WDRV_WINC_MQTT_CONN_MAX_ASSIGNED_CLIENT_ID      48
 
+/* Number of driver managed topic aliases, zero disables automatic aliasing. */
+#ifndef WDRV_WINC_MQTT_TOPIC_ALIAS_NUM
+#define WDRV_WINC_MQTT_TOPIC_ALIAS_NUM                  0
+#endif
+
+/* The maximum length of a topic name which can be automatically aliased. */
+#ifndef WDRV_WINC_MQTT_TOPIC_ALIAS_MAX_TOPIC_LEN
+#define WDRV_WINC_MQTT_TOPIC_ALIAS_MAX_TOPIC_LEN        64
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver MQTT Data Types
@@ -618,6 +628,139 @@ typedef void (*WDRV_WINC_MQTT_PUB_STATUS_CALLBACK)
     WDRV_WINC_MQTT_PUB_STATUS_TYPE status
 );
 
+// *****************************************************************************
+/* MQTT Publish Table Entry
+
+  Summary:
+    In flight publish message state.
+
+  Description:
+    Tracks a publish message from submission until it is complete, this
+    allows each publish to have its own status callback.
+
+  Remarks:
+    The entry is matched by publish handle and command index until the packet
+    ID is known, and by packet ID for QoS 1 and 2 acknowledgements.
+*/
+
+typedef struct
+{
+    /* Flag indicating if this entry is in use. */
+    bool inUse;
+
+    /* Flag indicating if the packet ID is known. */
+    bool packetIdValid;
+
+    /* QoS level of the publish message. */
+    WDRV_WINC_MQTT_QOS_TYPE qos;
+
+    /* Index of the MQTTPUB command within the command request. */
+    uint8_t cmdIdx;
+
+    /* Topic alias registered by this publish, or zero. */
+    uint16_t topicAlias;
+
+    /* Packet ID assigned by the WINC. */
+    uint16_t packetId;
+
+    /* Publish handle issued to the caller. */
+    WDRV_WINC_MQTT_PUB_HANDLE pubHandle;
+
+    /* Publish status callback function pointer. */
+    WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb;
+
+    /* Publish status callback user context. */
+    uintptr_t pubStatusCbCtx;
+} WDRV_WINC_MQTT_PUB_ENTRY;
+
+// *****************************************************************************
+/* MQTT Publish Early Acknowledgement
+
+  Summary:
+    Publish acknowledgement received ahead of its packet ID.
+
+  Description:
+    Holds a PUBACK, PUBCOMP or PUBERR which arrived before the MQTTPUB
+    response reporting the packet ID of the publish it completes.
+
+  Remarks:
+    Only held while a publish table entry is awaiting its packet ID.
+*/
+
+typedef struct
+{
+    /* Flag indicating if this entry is in use. */
+    bool valid;
+
+    /* Packet ID acknowledged. */
+    uint16_t packetId;
+
+    /* Status to report when the publish is matched. */
+    WDRV_WINC_MQTT_PUB_STATUS_TYPE status;
+} WDRV_WINC_MQTT_PUB_EARLY_ACK;
+
+// *****************************************************************************
+/* MQTT Publish Batch Element
+
+  Summary:
+    Message description for a batched publish.
+
+  Description:
+    Describes one message passed to WDRV_WINC_MQTTPublishBatch.
+
+  Remarks:
+    The fields match the parameters of WDRV_WINC_MQTTPublish.
+*/
+
+typedef struct
+{
+    /* Pointer to message information if required. */
+    const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo;
+
+    /* Pointer to topic name. */
+    const char *pTopicName;
+
+    /* Pointer to data to publish to topic. */
+    const uint8_t *pTopicData;
+
+    /* Length of data to publish. */
+    size_t topicDataLen;
+
+    /* User context to be passed to callback for this message. */
+    uintptr_t pubStatusCbCtx;
+} WDRV_WINC_MQTT_PUB_BATCH_ELEM;
+
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+// *****************************************************************************
+/* MQTT Topic Alias Table Entry
+
+  Summary:
+    Driver managed topic alias.
+
+  Description:
+    Maps a topic name to the topic alias registered with the broker.
+
+  Remarks:
+    Entries are only valid for the lifetime of a connection. An alias is
+    only used alone once the publish registering it has been sent.
+*/
+
+typedef struct
+{
+    /* Topic alias, zero if the entry is unused. */
+    uint16_t topicAlias;
+
+    /* Flag indicating the publish registering the alias has been sent. */
+    bool registered;
+
+    /* Usage stamp for least recently used eviction. */
+    uint32_t lastUsed;
+
+    /* Topic name associated with the alias. */
+    char topicName[WDRV_WINC_MQTT_TOPIC_ALIAS_MAX_TOPIC_LEN+1];
+} WDRV_WINC_MQTT_TOPIC_ALIAS_ENTRY;
+#endif
+
 // *****************************************************************************
 /*
   Function:
@@ -1022,6 +1165,7 @@ WDRV_WINC_STATUS WDRV_WINC_MQTTDisconnect
     WDRV_WINC_STATUS_NOT_OPEN       - The driver instance is not open.
     WDRV_WINC_STATUS_REQUEST_ERROR  - The request to the WINC was rejected.
     WDRV_WINC_STATUS_INVALID_ARG    - The parameters were incorrect.
+    WDRV_WINC_STATUS_BUSY           - All publish table entries are in use.
 
   Remarks:
     The publish handle returned is only valid until the callback is called
@@ -1029,12 +1173,26 @@ WDRV_WINC_STATUS WDRV_WINC_MQTTDisconnect
     valid and should be discarded. Further updates to the callback will use
     the packet ID. This is only relevant to QoS 1 and 2.
 
+    Up to WDRV_WINC_MQTT_PUB_NUM publishes may be in flight, each retains
+    its own callback and context until the PUBACK (QoS 1) or PUBCOMP (QoS 2)
+    is received. QoS 0 publishes are released once sent. Any publishes still
+    in flight when the connection is lost are completed with
+    WDRV_WINC_MQTT_PUB_STATUS_ERROR.
+
     To use topic aliases in MQTT V5 a publish must be sent first with both
     pTopicName and pMsgInfo->pProperties->topicAlias being valid. Once the
     alias is registered with the broker WDRV_WINC_MQTTPublish can be called
     with pTopicName equal to NULL as long as pMsgInfo->pProperties->topicAlias
     is set to the registered alias ID.
 
+    If WDRV_WINC_MQTT_TOPIC_ALIAS_NUM is non-zero and the broker accepts
+    topic aliases, topic names without an explicit alias are aliased by
+    the driver. The first publish to a topic registers an alias with the
+    full topic name, later publishes send only the alias. When the table is
+    full, or the broker's topic alias maximum is reached, the least recently
+    used alias is reassigned. Application assigned aliases should not be
+    mixed with automatic aliasing.
+
 */
 
 WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
@@ -1049,6 +1207,66 @@ WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
     WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
 );
 
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_MQTTPublishBatch
+    (
+        DRV_HANDLE handle,
+        const WDRV_WINC_MQTT_PUB_BATCH_ELEM *pPubElems,
+        size_t numPubElems,
+        WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
+        WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+    )
+
+  Summary:
+    Publish several messages to MQTT topics.
+
+  Description:
+    Publishes several messages, all MQTTPUB commands are built into a single
+    command request and submitted to the WINC in one transmission.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle        - Client handle obtained by a call to WDRV_WINC_Open.
+    pPubElems     - Pointer to array of messages to publish.
+    numPubElems   - Number of messages in array.
+    pfPubStatusCb - Pointer to publish status callback.
+    pPubHandle    - Pointer to handle to receive short term publish handle.
+
+  Returns:
+    WDRV_WINC_STATUS_OK             - The publishes were sent.
+    WDRV_WINC_STATUS_NOT_OPEN       - The driver instance is not open.
+    WDRV_WINC_STATUS_REQUEST_ERROR  - The request to the WINC was rejected.
+    WDRV_WINC_STATUS_INVALID_ARG    - The parameters were incorrect.
+    WDRV_WINC_STATUS_BUSY           - Not enough free publish table entries.
+
+  Remarks:
+    numPubElems must not exceed WDRV_WINC_MQTT_PUB_BATCH_NUM. A publish
+    table entry is only needed for QoS 1 and 2 messages, or for QoS 0
+    messages when pfPubStatusCb is provided, enough entries must be free
+    for those messages.
+
+    The batch is sent in full or not at all, if any status other than
+    WDRV_WINC_STATUS_OK is returned none of the messages were sent.
+
+    All messages share the same publish handle, the callback user context
+    of each message identifies which message a status refers to.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_MQTTPublishBatch
+(
+    DRV_HANDLE handle,
+    const WDRV_WINC_MQTT_PUB_BATCH_ELEM *pPubElems,
+    size_t numPubElems,
+    WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
+    WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+);
+
 //*******************************************************************************
 /*
   Function:
@@ -64,6 +64,11 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
+/* Maximum number of NVM write commands outstanding during a program operation. */
+#ifndef WDRV_WINC_NVM_PROGRAM_WINDOW
+#define WDRV_WINC_NVM_PROGRAM_WINDOW    4U
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver NVM Data Types
@@ -99,7 +104,10 @@ typedef enum
     WDRV_WINC_NVM_OPERATION_READ,
 
     /* Check data validity operation. */
-    WDRV_WINC_NVM_OPERATION_CHECK
+    WDRV_WINC_NVM_OPERATION_CHECK,
+
+    /* Erase, write and check data operation. */
+    WDRV_WINC_NVM_OPERATION_PROGRAM
 } WDRV_WINC_NVM_OPERATION_TYPE;
 
 // *****************************************************************************
@@ -260,6 +268,29 @@ typedef struct
     const uint8_t *pData;
 } WDRV_WINC_NVM_READ_STATUS_INFO;
 
+// *****************************************************************************
+/* NVM Program Status Information
+
+  Summary:
+    Information pertaining to NVM program operations.
+
+  Description:
+    Status information provided upon successful completion of NVM program operation.
+
+  Remarks:
+    None.
+
+*/
+
+typedef struct
+{
+    /* Result of the check of the programmed region. */
+    WDRV_WINC_NVM_CHK_STATUS_INFO check;
+
+    /* Time taken by the erase, write and check operations in milliseconds. */
+    uint32_t elapsedMs;
+} WDRV_WINC_NVM_PROGRAM_STATUS_INFO;
+
 // *****************************************************************************
 /* NVM Status Callback Function Pointer
 
@@ -302,6 +333,9 @@ typedef struct
         WDRV_WINC_NVM_OPERATION_CHECK:
             WDRV_WINC_CHK_STATUS_INFO
 
+        WDRV_WINC_NVM_OPERATION_PROGRAM:
+            WDRV_WINC_NVM_PROGRAM_STATUS_INFO
+
 */
 
 typedef void (*WDRV_WINC_NVM_STATUS_CALLBACK)
@@ -343,6 +377,30 @@ typedef struct
     /* Length of data within NVM operation. */
     uint32_t length;
 
+    struct
+    {
+        /* Pointer to next application data to write. */
+        const uint8_t *pData;
+
+        /* Offset of programmed region within NVM partition. */
+        uint32_t startOffset;
+
+        /* Length of programmed region. */
+        uint32_t totalLength;
+
+        /* Offset of the end of the sector currently being written. */
+        uint32_t sectorEnd;
+
+        /* Number of write commands awaiting status. */
+        uint8_t numPending;
+
+        /* Check algorithm to apply once written. */
+        WDRV_WINC_NVM_CHECK_MODE_TYPE mode;
+
+        /* System time counter value when the operation started. */
+        uint64_t startTime;
+    } program;
+
     /* NVM geometry information. */
     WDRV_WINC_NVM_GEOM_INFO geom;
 } WDRV_WINC_NVM_OPERATION_STATE;
@@ -624,6 +682,66 @@ WDRV_WINC_STATUS WDRV_WINC_NVMCheck
     WDRV_WINC_NVM_STATUS_CALLBACK pfUpdateStatusCB
 );
 
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_NVMProgram
+    (
+        DRV_HANDLE handle,
+        const void *pBuffer,
+        uint32_t offset,
+        uint32_t length,
+        WDRV_WINC_NVM_CHECK_MODE_TYPE mode,
+        WDRV_WINC_NVM_STATUS_CALLBACK pfUpdateStatusCB
+    )
+
+  Summary:
+    Programs data into the NVM.
+
+  Description:
+    Erases, writes and checks a region of the NVM in a single operation.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle           - Client handle obtained by a call to WDRV_WINC_Open.
+    pBuffer          - Pointer to buffer containing the data to write.
+    offset           - Sector aligned offset within the NVM to write the data to.
+    length           - Number of bytes to be written.
+    mode             - Algorithm to be used to check memory once written.
+    pfUpdateStatusCB - Callback to indicate update status.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The request has been accepted.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+    WDRV_WINC_STATUS_REQUEST_ERROR - The request to the WINC was rejected.
+
+  Remarks:
+    Each sector is erased immediately before the first write into it, up to
+      WDRV_WINC_NVM_PROGRAM_WINDOW write commands are then kept outstanding
+      until the sector is written. Any remainder of the final sector is erased.
+
+    pBuffer must remain valid until the callback is called.
+
+    When a program operation completes the callback is called with opStatusInfo
+      being the structure WDRV_WINC_NVM_PROGRAM_STATUS_INFO, the application
+      should compare the check result against the expected value.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_NVMProgram
+(
+    DRV_HANDLE handle,
+    const void *pBuffer,
+    uint32_t offset,
+    uint32_t length,
+    WDRV_WINC_NVM_CHECK_MODE_TYPE mode,
+    WDRV_WINC_NVM_STATUS_CALLBACK pfUpdateStatusCB
+);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -64,6 +64,14 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
+/* Value of the magic field in a valid resumable OTA state block. */
+#define WDRV_WINC_OTA_RESUME_MAGIC      0x4F544132U
+
+/* Maximum length of the image identity held in a resumable OTA state block. */
+#ifndef WDRV_WINC_OTA_RESUME_ID_MAX_LEN
+#define WDRV_WINC_OTA_RESUME_ID_MAX_LEN 32U
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver OTA Data Types
@@ -112,6 +120,9 @@ typedef enum
 
     /* The server returned an error. */
     WDRV_WINC_OTA_STATUS_SERVER_ERROR,
+
+    /* A resumable OTA chunk has been written. */
+    WDRV_WINC_OTA_STATUS_PROGRESS,
 } WDRV_WINC_OTA_UPDATE_STATUS;
 
 // *****************************************************************************
@@ -144,6 +155,9 @@ typedef enum
 
     /* Invalidate image. */
     WDRV_WINC_OTA_OPERATION_INVALIDATE,
+
+    /* Host supplied resumable image write. */
+    WDRV_WINC_OTA_OPERATION_RESUMABLE_WRITE,
 } WDRV_WINC_OTA_OPERATION_TYPE;
 
 // *****************************************************************************
@@ -187,6 +201,113 @@ typedef void (*WDRV_WINC_OTA_STATUS_CALLBACK)
     WDRV_WINC_OTA_UPDATE_STATUS status
 );
 
+// *****************************************************************************
+/*  Resumable OTA State
+
+  Summary:
+    Resumable OTA state block.
+
+  Description:
+    Records the image being written and how much of it has been written to
+      the NVM. The application keeps this block in persistent storage so an
+      interrupted download can restart from offset, for example with an HTTP
+      range request.
+
+  Remarks:
+    The block is valid when magic is WDRV_WINC_OTA_RESUME_MAGIC.
+
+*/
+
+typedef struct
+{
+    /* WDRV_WINC_OTA_RESUME_MAGIC when the block is valid. */
+    uint32_t magic;
+
+    /* Total length of the image. */
+    uint32_t imageLength;
+
+    /* Number of bytes from the start of the image written to the NVM. */
+    uint32_t offset;
+
+    /* Length of the image identity. */
+    uint8_t imageIdLength;
+
+    /* Image identity, for example a digest or HTTP ETag of the image. */
+    uint8_t imageId[WDRV_WINC_OTA_RESUME_ID_MAX_LEN];
+} WDRV_WINC_OTA_RESUME_STATE;
+
+// *****************************************************************************
+/*  Resumable OTA Progress Information
+
+  Summary:
+    Resumable OTA chunk progress information.
+
+  Description:
+    Details of the chunk reported by a resumable OTA progress callback.
+
+  Remarks:
+    None.
+
+*/
+
+typedef struct
+{
+    /* Offset of the chunk within the image. */
+    uint32_t offset;
+
+    /* Length of the chunk. */
+    uint32_t length;
+
+    /* Time taken to erase and write the chunk in milliseconds. */
+    uint32_t elapsedMs;
+
+    /* Chunk write throughput in bytes per second, zero if too fast to measure. */
+    uint32_t bytesPerSec;
+} WDRV_WINC_OTA_PROGRESS_INFO;
+
+// *****************************************************************************
+/* Resumable OTA Progress Callback Function Pointer
+
+  Function:
+    void (*WDRV_WINC_OTA_PROGRESS_CALLBACK)
+    (
+        DRV_HANDLE handle,
+        const WDRV_WINC_OTA_RESUME_STATE *const pState,
+        const WDRV_WINC_OTA_PROGRESS_INFO *const pInfo,
+        WDRV_WINC_OTA_UPDATE_STATUS status
+    )
+
+  Summary:
+    Pointer to a resumable OTA progress callback function.
+
+  Description:
+    This defines a callback type which is called as each chunk passed to
+      WDRV_WINC_OTAResumableWrite completes.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+    pState - Pointer to the updated state block, to be persisted.
+    pInfo  - Pointer to details of the chunk.
+    status - WDRV_WINC_OTA_STATUS_PROGRESS, WDRV_WINC_OTA_STATUS_COMPLETE
+               for the final chunk or WDRV_WINC_OTA_STATUS_FAIL.
+
+  Returns:
+    None.
+
+  Remarks:
+    On failure the state block is not advanced and the same chunk can be
+      written again.
+
+*/
+
+typedef void (*WDRV_WINC_OTA_PROGRESS_CALLBACK)
+(
+    DRV_HANDLE handle,
+    const WDRV_WINC_OTA_RESUME_STATE *const pState,
+    const WDRV_WINC_OTA_PROGRESS_INFO *const pInfo,
+    WDRV_WINC_OTA_UPDATE_STATUS status
+);
+
 // *****************************************************************************
 /*  OTA Operation State
 
@@ -211,6 +332,21 @@ typedef struct
 
     /* Callback to use for events relating to firmware update downloads. */
     WDRV_WINC_OTA_STATUS_CALLBACK pfOperationStatusCB;
+
+    /* Resumable write state block. */
+    WDRV_WINC_OTA_RESUME_STATE *pResumeState;
+
+    /* Callback to use for resumable write progress. */
+    WDRV_WINC_OTA_PROGRESS_CALLBACK pfProgressCB;
+
+    /* Chunk currently being written. */
+    const uint8_t *pChunk;
+
+    /* Length of chunk currently being written, zero if none. */
+    uint32_t chunkLength;
+
+    /* System time counter when the current chunk was started. */
+    uint64_t chunkStartTime;
 } WDRV_WINC_OTA_OPERATION_STATE;
 
 // *****************************************************************************
@@ -485,6 +621,151 @@ WDRV_WINC_STATUS WDRV_WINC_OTAOptionsSet
     const WDRV_WINC_OTA_OPTIONS *const pOTAOptions
 );
 
+#ifndef WDRV_WINC_MOD_DISABLE_NVM
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_OTAResumableStart
+    (
+        DRV_HANDLE handle,
+        WDRV_WINC_OTA_RESUME_STATE *const pState,
+        uint32_t imageLength,
+        const uint8_t *const pImageId,
+        size_t imageIdLength,
+        const WDRV_WINC_OTA_PROGRESS_CALLBACK pfProgressCB
+    )
+
+  Summary:
+    Starts or resumes a host supplied OTA image write.
+
+  Description:
+    Begins writing an OTA image supplied by the application in chunks to the
+      NVM. If the state block is valid and describes an image with the same
+      length and identity the write resumes from the recorded offset,
+      otherwise the state block is reset and the write starts from the
+      beginning.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle        - Client handle obtained by a call to WDRV_WINC_Open.
+    pState        - Pointer to the state block, restored from persistent
+                      storage.
+    imageLength   - Total length of the image.
+    pImageId      - Pointer to the image identity.
+    imageIdLength - Length of the image identity.
+    pfProgressCB  - Callback to indicate chunk progress.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The request has been accepted.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+    WDRV_WINC_STATUS_REQUEST_ERROR - An OTA operation is already in progress.
+
+  Remarks:
+    The application fetches the image from pState->offset onwards, the state
+      block must remain valid until the write completes or is stopped.
+
+    The image identity must change whenever the image content changes, for
+      example a digest of the image or the HTTP ETag of the image resource.
+      It is limited to WDRV_WINC_OTA_RESUME_ID_MAX_LEN bytes.
+
+    Once complete, WDRV_WINC_OTAImageVerify and WDRV_WINC_OTAImageActivate
+      are used as for WDRV_WINC_OTAUpdateFromURL.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_OTAResumableStart
+(
+    DRV_HANDLE handle,
+    WDRV_WINC_OTA_RESUME_STATE *const pState,
+    uint32_t imageLength,
+    const uint8_t *const pImageId,
+    size_t imageIdLength,
+    const WDRV_WINC_OTA_PROGRESS_CALLBACK pfProgressCB
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_OTAResumableWrite
+    (
+        DRV_HANDLE handle,
+        const void *const pData,
+        uint32_t length
+    )
+
+  Summary:
+    Writes the next chunk of a resumable OTA image.
+
+  Description:
+    Writes the chunk to the NVM at the current state block offset, erasing
+      any sectors the chunk starts. The progress callback is called once the
+      chunk has been written.
+
+  Precondition:
+    WDRV_WINC_OTAResumableStart must have been called.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+    pData  - Pointer to chunk data.
+    length - Length of chunk data.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The request has been accepted.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+    WDRV_WINC_STATUS_REQUEST_ERROR - No resumable write is active, a chunk
+                                       is still being written or the request
+                                       to the WINC was rejected.
+
+  Remarks:
+    pData must remain valid until the progress callback is called.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_OTAResumableWrite
+(
+    DRV_HANDLE handle,
+    const void *const pData,
+    uint32_t length
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_OTAResumableStop(DRV_HANDLE handle)
+
+  Summary:
+    Stops a resumable OTA image write.
+
+  Description:
+    Ends the resumable write without changing the state block, so it can be
+      resumed later by WDRV_WINC_OTAResumableStart.
+
+  Precondition:
+    WDRV_WINC_OTAResumableStart must have been called.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The write has been stopped.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+    WDRV_WINC_STATUS_REQUEST_ERROR - No resumable write is active or a chunk
+                                       is still being written.
+
+  Remarks:
+    None.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_OTAResumableStop(DRV_HANDLE handle);
+#endif /* WDRV_WINC_MOD_DISABLE_NVM */
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
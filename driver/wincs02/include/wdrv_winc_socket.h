@@ -62,6 +62,25 @@ Microchip or any third party.
 #endif
 // DOM-IGNORE-END
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: WINC Driver Socket Mode Defines
+// *****************************************************************************
+// *****************************************************************************
+
+/* Number of targets within a ping session. */
+#ifndef WDRV_WINC_PING_TARGET_NUM
+#define WDRV_WINC_PING_TARGET_NUM       4U
+#endif
+
+/* Number of results held for each ping target. */
+#ifndef WDRV_WINC_PING_HISTORY_NUM
+#define WDRV_WINC_PING_HISTORY_NUM      16U
+#endif
+
+/* Round trip time recorded for a lost echo request. */
+#define WDRV_WINC_PING_RTT_LOST         0xffffU
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver Socket Mode Data Types
@@ -107,6 +126,180 @@ typedef void (*WDRV_WINC_ICMP_ECHO_RSP_EVENT_HANDLER)
     uint16_t rtt
 );
 
+// *****************************************************************************
+/*
+  Function:
+    void (*WDRV_WINC_PING_RESULT_CALLBACK)
+    (
+        DRV_HANDLE handle,
+        uint8_t targetIdx,
+        uint16_t seqNum,
+        uint16_t rtt
+    )
+
+  Summary:
+    Pointer to a ping session result callback function.
+
+  Description:
+    This data type defines a function which is called as each echo request
+    sent by a ping session completes.
+
+  Parameters:
+    handle    - Client handle obtained by a call to WDRV_WINC_Open.
+    targetIdx - Index of the target.
+    seqNum    - Sequence number of the echo request.
+    rtt       - Round trip time, or WDRV_WINC_PING_RTT_LOST.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+
+*/
+
+typedef void (*WDRV_WINC_PING_RESULT_CALLBACK)
+(
+    DRV_HANDLE handle,
+    uint8_t targetIdx,
+    uint16_t seqNum,
+    uint16_t rtt
+);
+
+// *****************************************************************************
+/*  Ping Statistics
+
+  Summary:
+    Ping session target statistics.
+
+  Description:
+    Statistics for a ping session target. Counts of requests sent and replies
+      received cover the whole session, the remaining fields are calculated
+      over the most recent WDRV_WINC_PING_HISTORY_NUM requests.
+
+  Remarks:
+    Round trip times are only valid if numSamples is greater than numLost.
+
+*/
+
+typedef struct
+{
+    /* Number of echo requests sent. */
+    uint32_t sent;
+
+    /* Number of echo replies received. */
+    uint32_t received;
+
+    /* Number of results within the history. */
+    uint8_t numSamples;
+
+    /* Number of lost requests within the history. */
+    uint8_t numLost;
+
+    /* Minimum round trip time. */
+    uint16_t minRtt;
+
+    /* Average round trip time. */
+    uint16_t avgRtt;
+
+    /* Maximum round trip time. */
+    uint16_t maxRtt;
+
+    /* Mean difference between consecutive round trip times. */
+    uint16_t jitter;
+} WDRV_WINC_PING_STATS;
+
+// *****************************************************************************
+/*  Ping Target
+
+  Summary:
+    Ping session target.
+
+  Description:
+    State of a ping session target.
+
+  Remarks:
+    None.
+
+*/
+
+typedef struct
+{
+    /* Flag indicating if the target is in use. */
+    bool inUse;
+
+    /* Flag indicating if an echo request is outstanding. */
+    bool outstanding;
+
+    /* Target address type. */
+    WDRV_WINC_IP_ADDRESS_TYPE ipAddrType;
+
+    /* Target address. */
+    WDRV_WINC_IP_MULTI_ADDRESS ipAddr;
+
+    /* Sequence number of the most recent echo request. */
+    uint16_t seqNum;
+
+    /* Command request carrying the outstanding echo request. */
+    WINC_CMD_REQ_HANDLE cmdReqHandle;
+
+    /* System time counter value when the most recent echo request was sent. */
+    uint64_t sendTime;
+
+    /* Number of echo requests sent. */
+    uint32_t sent;
+
+    /* Number of echo replies received. */
+    uint32_t received;
+
+    /* Index of next history entry to write. */
+    uint8_t historyHead;
+
+    /* Number of valid history entries. */
+    uint8_t historyCount;
+
+    /* Round trip time history. */
+    uint16_t history[WDRV_WINC_PING_HISTORY_NUM];
+} WDRV_WINC_PING_TARGET;
+
+// *****************************************************************************
+/*  Ping Session
+
+  Summary:
+    Ping session state.
+
+  Description:
+    State of the periodic multi-target ping session.
+
+  Remarks:
+    None.
+
+*/
+
+typedef struct
+{
+    /* Flag indicating if the session is running. */
+    bool active;
+
+    /* Flag indicating if the next round should be sent immediately. */
+    bool roundDue;
+
+    /* Interval between rounds of echo requests in milliseconds. */
+    uint32_t intervalMs;
+
+    /* Time to wait for an echo reply in milliseconds. */
+    uint32_t timeoutMs;
+
+    /* System time counter value when the last round was sent. */
+    uint64_t roundTime;
+
+    /* Callback for each echo request result. */
+    WDRV_WINC_PING_RESULT_CALLBACK pfResultCB;
+
+    /* Targets. */
+    WDRV_WINC_PING_TARGET targets[WDRV_WINC_PING_TARGET_NUM];
+} WDRV_WINC_PING_SESSION;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver Socket Mode Routines
@@ -239,6 +432,251 @@ WDRV_WINC_STATUS WDRV_WINC_ICMPEchoRequestAddr
     const WDRV_WINC_ICMP_ECHO_RSP_EVENT_HANDLER pfICMPEchoResponseCB
 );
 
+#ifndef WDRV_WINC_MOD_DISABLE_ICMP
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetAdd
+    (
+        DRV_HANDLE handle,
+        const WDRV_WINC_IP_MULTI_ADDRESS *const pIPAddr,
+        WDRV_WINC_IP_ADDRESS_TYPE ipAddrType,
+        uint8_t *const pTargetIdx
+    )
+
+  Summary:
+    Adds a target to the ping session.
+
+  Description:
+    Adds an address to the set of targets sent echo requests by the ping session.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle     - Client handle obtained by a call to WDRV_WINC_Open.
+    pIPAddr    - Pointer to IP address of the target.
+    ipAddrType - Address type.
+    pTargetIdx - Pointer to receive the index of the target.
+
+  Returns:
+    WDRV_WINC_STATUS_OK             - The target has been added.
+    WDRV_WINC_STATUS_NOT_OPEN       - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG    - The parameters were incorrect.
+    WDRV_WINC_STATUS_NO_SPACE       - All targets are in use.
+
+  Remarks:
+    Targets may be added while the session is running.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetAdd
+(
+    DRV_HANDLE handle,
+    const WDRV_WINC_IP_MULTI_ADDRESS *const pIPAddr,
+    WDRV_WINC_IP_ADDRESS_TYPE ipAddrType,
+    uint8_t *const pTargetIdx
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetRemove
+    (
+        DRV_HANDLE handle,
+        uint8_t targetIdx
+    )
+
+  Summary:
+    Removes a target from the ping session.
+
+  Description:
+    Removes a target and its statistics from the ping session.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle    - Client handle obtained by a call to WDRV_WINC_Open.
+    targetIdx - Index of the target.
+
+  Returns:
+    WDRV_WINC_STATUS_OK             - The target has been removed.
+    WDRV_WINC_STATUS_NOT_OPEN       - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG    - The parameters were incorrect.
+
+  Remarks:
+    None.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetRemove
+(
+    DRV_HANDLE handle,
+    uint8_t targetIdx
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStart
+    (
+        DRV_HANDLE handle,
+        uint32_t intervalMs,
+        uint32_t timeoutMs,
+        const WDRV_WINC_PING_RESULT_CALLBACK pfResultCB
+    )
+
+  Summary:
+    Starts the ping session.
+
+  Description:
+    Starts sending periodic echo requests to all ping session targets.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle     - Client handle obtained by a call to WDRV_WINC_Open.
+    intervalMs - Interval between rounds of echo requests in milliseconds.
+    timeoutMs  - Time to wait for an echo reply in milliseconds.
+    pfResultCB - Optional callback for each echo request result.
+
+  Returns:
+    WDRV_WINC_STATUS_OK             - The session has been started.
+    WDRV_WINC_STATUS_NOT_OPEN       - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG    - The parameters were incorrect.
+
+  Remarks:
+    Each round sends one echo request to every target without one
+      outstanding, so requests to different targets run concurrently. Replies
+      are matched to the target by address and recorded against its
+      outstanding sequence number, a request without a reply within timeoutMs
+      is recorded as lost. A request rejected by the WINC is not sent and is
+      not recorded.
+
+    A reply whose round trip time is longer than the time since the
+      outstanding request was sent belongs to an earlier request and is
+      discarded. A late reply to an earlier request which arrives within its
+      own round trip time of the new request cannot be told apart and is
+      recorded against the new request.
+
+    Echo requests from WDRV_WINC_ICMPEchoRequestAddr should not be sent to
+      session targets while the session is running.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStart
+(
+    DRV_HANDLE handle,
+    uint32_t intervalMs,
+    uint32_t timeoutMs,
+    const WDRV_WINC_PING_RESULT_CALLBACK pfResultCB
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStop(DRV_HANDLE handle)
+
+  Summary:
+    Stops the ping session.
+
+  Description:
+    Stops sending echo requests, targets and statistics are retained.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+
+  Returns:
+    WDRV_WINC_STATUS_OK             - The session has been stopped.
+    WDRV_WINC_STATUS_NOT_OPEN       - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG    - The parameters were incorrect.
+
+  Remarks:
+    None.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStop(DRV_HANDLE handle);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStatsGet
+    (
+        DRV_HANDLE handle,
+        uint8_t targetIdx,
+        WDRV_WINC_PING_STATS *const pStats
+    )
+
+  Summary:
+    Retrieves ping session target statistics.
+
+  Description:
+    Calculates the statistics for a ping session target from its history.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle    - Client handle obtained by a call to WDRV_WINC_Open.
+    targetIdx - Index of the target.
+    pStats    - Pointer to structure to receive the statistics.
+
+  Returns:
+    WDRV_WINC_STATUS_OK             - The statistics have been returned.
+    WDRV_WINC_STATUS_NOT_OPEN       - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG    - The parameters were incorrect.
+
+  Remarks:
+    None.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStatsGet
+(
+    DRV_HANDLE handle,
+    uint8_t targetIdx,
+    WDRV_WINC_PING_STATS *const pStats
+);
+
+//*******************************************************************************
+/*
+  Function:
+    void WDRV_WINC_ICMPPingSessionTasks(DRV_HANDLE handle)
+
+  Summary:
+    Ping session state machine.
+
+  Description:
+    Sends echo requests when due and records lost requests.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+
+  Returns:
+    None.
+
+  Remarks:
+    Called from WDRV_WINC_Tasks.
+
+*/
+
+void WDRV_WINC_ICMPPingSessionTasks(DRV_HANDLE handle);
+#endif
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -296,4 +296,94 @@ WDRV_WINC_STATUS WDRV_WINC_BSSRoamingConfigure
     WDRV_WINC_BSS_ROAMING_CFG roamingCfg
 );
 
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_BSSReconnectStore
+    (
+        DRV_HANDLE handle,
+        const char *pFilename
+    )
+
+  Summary:
+    Stores the current connection for a later fast reconnect.
+
+  Description:
+    Records the BSSID and channel of the current connection in the active
+      station configuration and archives it, together with the SSID and
+      security settings, to a flash file.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+    The station must be connected to a BSS.
+
+  Parameters:
+    handle    - Client handle obtained by a call to WDRV_WINC_Open.
+    pFilename - Pointer to a filename to store the configuration in.
+
+  Returns:
+    WDRV_WINC_STATUS_OK              - The request has been accepted.
+    WDRV_WINC_STATUS_NOT_OPEN        - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG     - The parameters were incorrect.
+    WDRV_WINC_STATUS_REQUEST_ERROR   - The request to the WINC was rejected.
+
+  Remarks:
+    The archive is written using WDRV_WINC_CfgArchiveStore.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_BSSReconnectStore
+(
+    DRV_HANDLE handle,
+    const char *pFilename
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_BSSReconnect
+    (
+        DRV_HANDLE handle,
+        const char *pFilename,
+        const WDRV_WINC_BSSCON_NOTIFY_CALLBACK pfNotifyCallback
+    )
+
+  Summary:
+    Fast reconnect to a previously stored BSS.
+
+  Description:
+    Recalls a configuration stored by WDRV_WINC_BSSReconnectStore and
+      attempts a directed join to the stored BSSID on the stored channel.
+      If the directed join fails the BSSID and channel are cleared and a
+      join using a full scan is attempted.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle           - Client handle obtained by a call to WDRV_WINC_Open.
+    pFilename        - Pointer to a filename to recall the configuration from.
+    pfNotifyCallback - Callback function to receive connection event notifications.
+
+  Returns:
+    WDRV_WINC_STATUS_OK              - The request has been accepted.
+    WDRV_WINC_STATUS_NOT_OPEN        - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG     - The parameters were incorrect.
+    WDRV_WINC_STATUS_REQUEST_ERROR   - The request to the WINC was rejected.
+
+  Remarks:
+    The connection callback only reports WDRV_WINC_CONN_STATE_FAILED once
+      the full scan fallback has also failed.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_BSSReconnect
+(
+    DRV_HANDLE handle,
+    const char *pFilename,
+    const WDRV_WINC_BSSCON_NOTIFY_CALLBACK pfNotifyCallback
+);
+
 #endif /* WDRV_WINC_STA_H */
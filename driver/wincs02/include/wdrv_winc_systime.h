@@ -52,6 +52,27 @@ Microchip or any third party.
 
 #include "wdrv_winc_common.h"
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: WINC Driver Systime Defines
+// *****************************************************************************
+// *****************************************************************************
+
+/* Default interval between host clock synchronisations with the WINC. */
+#ifndef WDRV_WINC_SYSTIME_RESYNC_INTERVAL_MS
+#define WDRV_WINC_SYSTIME_RESYNC_INTERVAL_MS        300000U
+#endif
+
+/* Minimum time between first and latest synchronisation before drift is estimated. */
+#ifndef WDRV_WINC_SYSTIME_DRIFT_MIN_BASELINE_MS
+#define WDRV_WINC_SYSTIME_DRIFT_MIN_BASELINE_MS     3600000U
+#endif
+
+/* Maximum drift correction applied to the host clock. */
+#ifndef WDRV_WINC_SYSTIME_DRIFT_MAX_PPM
+#define WDRV_WINC_SYSTIME_DRIFT_MAX_PPM             1000
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver Systime Data Types
@@ -91,6 +112,78 @@ typedef void (*WDRV_WINC_SYSTIME_CURRENT_CALLBACK)
     uint32_t timeUTC
 );
 
+// *****************************************************************************
+/*  Host Clock Statistics
+
+  Summary:
+    Host clock statistics.
+
+  Description:
+    Counts of time queries answered by the host clock and synchronisation
+      requests sent to the WINC.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Number of queries answered from the host clock. */
+    uint32_t localReads;
+
+    /* Number of synchronisation requests sent to the WINC. */
+    uint32_t syncRequests;
+
+    /* Number of synchronisations received from the WINC. */
+    uint32_t syncs;
+
+    /* Current drift correction in parts per million. */
+    int32_t driftPPM;
+} WDRV_WINC_SYSTIME_STATS;
+
+// *****************************************************************************
+/*  Host Clock State
+
+  Summary:
+    Host clock state.
+
+  Description:
+    State of the host maintained copy of the WINC system time.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Flag indicating if the host clock has been synchronised. */
+    bool valid;
+
+    /* Flag indicating if a synchronisation request is outstanding. */
+    bool syncPending;
+
+    /* UTC time of the last synchronisation. */
+    uint32_t baseUTC;
+
+    /* System time counter value at the last synchronisation. */
+    uint64_t baseCount;
+
+    /* UTC time of the first synchronisation, used for drift estimation. */
+    uint32_t firstUTC;
+
+    /* System time counter value at the first synchronisation. */
+    uint64_t firstCount;
+
+    /* Last time returned, used to keep reported time monotonic. */
+    uint32_t lastUTC;
+
+    /* Interval between synchronisations in milliseconds. */
+    uint32_t resyncIntervalMs;
+
+    /* Statistics. */
+    WDRV_WINC_SYSTIME_STATS stats;
+} WDRV_WINC_SYSTIME_HOST_CLOCK;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: WINC Driver Systime Routines
@@ -216,4 +309,130 @@ WDRV_WINC_STATUS WDRV_WINC_SystemTimeGetCurrent
     const WDRV_WINC_SYSTIME_CURRENT_CALLBACK pfGetCurrentCallback
 );
 
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SystemTimeGetLocal
+    (
+        DRV_HANDLE handle,
+        uint32_t *const pTimeUTC
+    )
+
+  Summary:
+    Returns the current system time from the host clock.
+
+  Description:
+    Returns the current system time extrapolated from the last synchronisation
+      with the WINC, without waiting for the bus.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle   - Client handle obtained by a call to WDRV_WINC_Open.
+    pTimeUTC - Pointer to receive the UTC time (epoch 01/01/1970).
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The time has been returned.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+    WDRV_WINC_STATUS_RETRY_REQUEST - The host clock is not yet synchronised.
+
+  Remarks:
+    The host clock is synchronised whenever the WINC reports the time, such as
+      following an SNTP update or a call to WDRV_WINC_SystemTimeGetCurrent.
+      If the host clock is unsynchronised, or the resynchronisation interval
+      has elapsed, a time request is sent to the WINC.
+
+    The time returned never decreases between synchronisations and is
+      corrected for the measured drift between the host and WINC clocks.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SystemTimeGetLocal
+(
+    DRV_HANDLE handle,
+    uint32_t *const pTimeUTC
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SystemTimeResyncIntervalSet
+    (
+        DRV_HANDLE handle,
+        uint32_t intervalMs
+    )
+
+  Summary:
+    Sets the host clock resynchronisation interval.
+
+  Description:
+    Configures how often the host clock is resynchronised with the WINC.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle     - Client handle obtained by a call to WDRV_WINC_Open.
+    intervalMs - Resynchronisation interval in milliseconds.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The interval has been set.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+
+  Remarks:
+    The default interval is WDRV_WINC_SYSTIME_RESYNC_INTERVAL_MS.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SystemTimeResyncIntervalSet
+(
+    DRV_HANDLE handle,
+    uint32_t intervalMs
+);
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SystemTimeStatsGet
+    (
+        DRV_HANDLE handle,
+        WDRV_WINC_SYSTIME_STATS *const pStats
+    )
+
+  Summary:
+    Retrieves the host clock statistics.
+
+  Description:
+    Copies the host clock query and synchronisation counts.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    handle - Client handle obtained by a call to WDRV_WINC_Open.
+    pStats - Pointer to structure to receive the statistics.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The statistics have been returned.
+    WDRV_WINC_STATUS_NOT_OPEN      - The driver instance is not open.
+    WDRV_WINC_STATUS_INVALID_ARG   - The parameters were incorrect.
+
+  Remarks:
+    The difference between localReads and syncRequests is the number of
+      bus transactions avoided.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SystemTimeStatsGet
+(
+    DRV_HANDLE handle,
+    WDRV_WINC_SYSTIME_STATS *const pStats
+);
+
 #endif /* WDRV_WINC_SYSTIME_H */
@@ -275,6 +275,14 @@ static void wincResetDeviceState(WDRV_WINC_CTRLDCPT *pCtrl)
     {
         pCtrl->tlscInfo[i].idxInUse = false;
     }
+
+    for (i=0; i<WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM; i++)
+    {
+        pCtrl->extCryptoSignQueue.entries[i].inUse = false;
+    }
+
+    pCtrl->extCryptoSignQueue.numOutstanding = 0;
+    pCtrl->extCryptoSignQueue.dispatching    = false;
 #endif
 
     for (i=0; i<WDRV_WINC_FILE_CTX_NUM; i++)
@@ -285,6 +293,9 @@ static void wincResetDeviceState(WDRV_WINC_CTRLDCPT *pCtrl)
 #ifndef WDRV_WINC_MOD_DISABLE_MQTT
     pCtrl->mqtt.connState = WDRV_WINC_MQTT_CONN_STATUS_DISCONNECTED;
     pCtrl->mqtt.pfConnCB  = NULL;
+
+    (void)memset(pCtrl->mqtt.pubTable, 0, sizeof(pCtrl->mqtt.pubTable));
+    (void)memset(pCtrl->mqtt.pubEarlyAck, 0, sizeof(pCtrl->mqtt.pubEarlyAck));
 #endif
 
     pCtrl->pfBSSFindNotifyCB        = NULL;
@@ -292,8 +303,13 @@ static void wincResetDeviceState(WDRV_WINC_CTRLDCPT *pCtrl)
     pCtrl->pfAssociationRSSICB      = NULL;
 #ifndef WDRV_WINC_MOD_DISABLE_ICMP
     pCtrl->pfICMPEchoResponseCB     = NULL;
+
+    pCtrl->pingSession.active       = false;
 #endif
     pCtrl->pfSystemTimeGetCurrentCB = NULL;
+
+    pCtrl->sysTimeHostClock.valid       = false;
+    pCtrl->sysTimeHostClock.syncPending = false;
 #ifndef WDRV_WINC_MOD_DISABLE_DNS
     pCtrl->pfDNSResolveResponseCB   = NULL;
 #endif
@@ -813,10 +829,23 @@ SYS_MODULE_OBJ WDRV_WINC_Initialize
             return SYS_MODULE_OBJ_INVALID;
         }
 #endif
+        WDRV_WINC_BSSFindCacheReset();
+
         (void)WINC_DevAECCallbackRegister(wincCtrlDescriptor.wincDevHandle, wincProcessAEC, (uintptr_t)pDcpt);
 
         wincCtrlDescriptor.delayTimer = SYS_TIME_HANDLE_INVALID;
 
+        (void)memset(&wincCtrlDescriptor.sysTimeHostClock.stats, 0, sizeof(WDRV_WINC_SYSTIME_STATS));
+        wincCtrlDescriptor.sysTimeHostClock.resyncIntervalMs = WDRV_WINC_SYSTIME_RESYNC_INTERVAL_MS;
+
+#ifndef WDRV_WINC_MOD_DISABLE_TLS
+        wincCtrlDescriptor.extCryptoSignQueue.pfSignCB       = NULL;
+        wincCtrlDescriptor.extCryptoSignQueue.maxOutstanding = 0;
+#endif
+#ifndef WDRV_WINC_MOD_DISABLE_ICMP
+        (void)memset(&wincCtrlDescriptor.pingSession, 0, sizeof(WDRV_WINC_PING_SESSION));
+#endif
+
         wincCtrlDescriptor.pfL2DataMonitorCB = NULL;
 #ifndef WDRV_WINC_MOD_DISABLE_PROV
         wincCtrlDescriptor.pfProvAttachCB = NULL;
@@ -1237,6 +1266,10 @@ void WDRV_WINC_Tasks(SYS_MODULE_OBJ object)
                 (void)WINC_DevHandleEvent(pDcpt->pCtrl->wincDevHandle, wincEventCheck);
             }
 
+#ifndef WDRV_WINC_MOD_DISABLE_ICMP
+            WDRV_WINC_ICMPPingSessionTasks((DRV_HANDLE)pDcpt);
+#endif
+
             if (false == WINC_DevUpdateEvent(pDcpt->pCtrl->wincDevHandle))
             {
                 WDRV_DBG_ERROR_PRINT("WINC event update failed, resetting\r\n");
@@ -1405,6 +1438,8 @@ DRV_HANDLE WDRV_WINC_Open(const SYS_MODULE_INDEX index, const DRV_IO_INTENT inte
         pDcpt->pCtrl->pfBSSFindNotifyCB       = NULL;
         pDcpt->pCtrl->pfConnectNotifyCB       = NULL;
         pDcpt->pCtrl->pfAssociationRSSICB     = NULL;
+
+        WDRV_WINC_BSSFindCacheReset();
     }
 
     pDcpt->isOpen = true;
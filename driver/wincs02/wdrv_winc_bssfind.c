@@ -56,8 +56,27 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
-/* Number of scan results to store in cache. */
+/* Number of scan results to store in cache, at most 255. */
+#ifndef WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES
 #define WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES     50u
+#endif
+
+/* Number of BSSID hash buckets, a power of two no larger than 256. */
+#ifndef WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE
+#define WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE       32u
+#endif
+
+/* Marks an empty hash bucket or the end of a hash chain. */
+#define WDRV_WINC_SCAN_RESULT_CACHE_INVALID         UINT8_MAX
+
+#if (WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES == 0) || (WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES > 255)
+#error WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES must be between 1 and 255
+#endif
+
+#if (WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE == 0) || (WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE > 256) \
+        || ((WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE & (WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE - 1)) != 0)
+#error WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE must be a power of two no larger than 256
+#endif
 
 // *****************************************************************************
 // *****************************************************************************
@@ -106,7 +125,9 @@ typedef struct
     WiFi scan results are stored in the cache for retrieval by the applicaiton.
 
   Remarks:
-    None.
+    Entries are deduplicated by BSSID using a hash index and are iterated in
+    order of descending RSSI through the order array. Entries themselves are
+    never moved once stored.
 */
 
 typedef struct
@@ -116,6 +137,15 @@ typedef struct
 
     /* Scan result entry, one per AP. */
     DRV_WINC_SCAN_RESULTS       bssDescr[WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES];
+
+    /* Entry indexes sorted by descending RSSI. */
+    uint8_t                     order[WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES];
+
+    /* First entry index of each BSSID hash chain. */
+    uint8_t                     hashHead[WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE];
+
+    /* Next entry index within the same BSSID hash chain. */
+    uint8_t                     hashNext[WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES];
 } WDRV_WINC_SCAN_RESULT_CACHE;
 
 // *****************************************************************************
@@ -132,6 +162,246 @@ static WDRV_WINC_SCAN_RESULT_CACHE scanResultCache;
 // Section: WINC Driver BSS Find Implementations
 // *****************************************************************************
 // *****************************************************************************
+//*******************************************************************************
+/*
+  Function:
+    void WDRV_WINC_BSSFindCacheReset(void)
+
+  Summary:
+    Empties the scan result cache.
+
+  Description:
+    Removes all entries from the scan result cache and clears its BSSID
+      hash index.
+
+  Remarks:
+    See wdrv_winc_bssfind.h for usage information.
+
+*/
+
+void WDRV_WINC_BSSFindCacheReset(void)
+{
+    scanResultCache.numDescrs = 0;
+
+    (void)memset(scanResultCache.hashHead, WDRV_WINC_SCAN_RESULT_CACHE_INVALID, sizeof(scanResultCache.hashHead));
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static uint8_t bssfindCacheHash(const uint8_t *pBSSID)
+
+  Summary:
+    Calculate the hash bucket of a BSSID.
+
+  Description:
+    Folds the BSSID into a hash bucket index.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pBSSID - Pointer to BSSID.
+
+  Returns:
+    Hash bucket index.
+
+  Remarks:
+    The low order bytes of a BSSID vary most between APs.
+
+*/
+
+static uint8_t bssfindCacheHash(const uint8_t *pBSSID)
+{
+    uint8_t hash = pBSSID[5];
+
+    hash ^= (uint8_t)(pBSSID[4] << 3) ^ (uint8_t)(pBSSID[4] >> 5);
+    hash ^= pBSSID[3];
+
+    return hash & (uint8_t)(WDRV_WINC_SCAN_RESULT_CACHE_HASH_SIZE - 1U);
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void bssfindCacheOrderRemove(uint8_t entry)
+
+  Summary:
+    Remove an entry from the RSSI order.
+
+  Description:
+    Removes an entry index from the RSSI sorted order array.
+
+  Precondition:
+    None.
+
+  Parameters:
+    entry - Entry index to remove.
+
+  Returns:
+    None.
+
+  Remarks:
+    The order array holds numDescrs-1 valid indexes afterwards.
+
+*/
+
+static void bssfindCacheOrderRemove(uint8_t entry)
+{
+    uint8_t i;
+
+    for (i=0; i<scanResultCache.numDescrs; i++)
+    {
+        if (entry == scanResultCache.order[i])
+        {
+            (void)memmove(&scanResultCache.order[i], &scanResultCache.order[i+1U], (size_t)scanResultCache.numDescrs - i - 1U);
+            break;
+        }
+    }
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void bssfindCacheOrderInsert(uint8_t entry, uint8_t numOrdered)
+
+  Summary:
+    Insert an entry into the RSSI order.
+
+  Description:
+    Inserts an entry index into the RSSI sorted order array after any
+    entries of equal or stronger RSSI.
+
+  Precondition:
+    None.
+
+  Parameters:
+    entry      - Entry index to insert.
+    numOrdered - Number of valid indexes currently in the order array.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+
+*/
+
+static void bssfindCacheOrderInsert(uint8_t entry, uint8_t numOrdered)
+{
+    int8_t rssi = scanResultCache.bssDescr[entry].rssi;
+    uint8_t i = numOrdered;
+
+    while ((i > 0U) && (scanResultCache.bssDescr[scanResultCache.order[i-1U]].rssi < rssi))
+    {
+        scanResultCache.order[i] = scanResultCache.order[i-1U];
+        i--;
+    }
+
+    scanResultCache.order[i] = entry;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void bssfindCacheInsert(const DRV_WINC_SCAN_RESULTS *pScanRes)
+
+  Summary:
+    Insert a scan result into the cache.
+
+  Description:
+    Updates the existing entry for the BSSID if present, otherwise adds a
+    new entry. If the cache is full the weakest entry is replaced if the
+    new result has a stronger RSSI.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pScanRes - Pointer to scan result.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+
+*/
+
+static void bssfindCacheInsert(const DRV_WINC_SCAN_RESULTS *pScanRes)
+{
+    uint8_t hash = bssfindCacheHash(pScanRes->bssid.addr);
+    uint8_t entry = scanResultCache.hashHead[hash];
+    uint8_t steps = 0;
+
+    /* Search the hash chain for an existing entry with this BSSID, a chain
+       can never be longer than the number of entries in the cache. */
+    while ((entry < scanResultCache.numDescrs) && (steps < scanResultCache.numDescrs))
+    {
+        if (0 == memcmp(scanResultCache.bssDescr[entry].bssid.addr, pScanRes->bssid.addr, WDRV_WINC_MAC_ADDR_LEN))
+        {
+            /* Repeated sighting, update in place and reposition. */
+            bssfindCacheOrderRemove(entry);
+
+            (void)memcpy(&scanResultCache.bssDescr[entry], pScanRes, sizeof(DRV_WINC_SCAN_RESULTS));
+
+            bssfindCacheOrderInsert(entry, scanResultCache.numDescrs - 1U);
+            return;
+        }
+
+        entry = scanResultCache.hashNext[entry];
+        steps++;
+    }
+
+    if (scanResultCache.numDescrs < WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES)
+    {
+        entry = scanResultCache.numDescrs;
+        scanResultCache.numDescrs++;
+    }
+    else
+    {
+        uint8_t *pLink;
+
+        /* Cache full, evict the weakest entry if this result is stronger. */
+        entry = scanResultCache.order[scanResultCache.numDescrs - 1U];
+
+        if (scanResultCache.bssDescr[entry].rssi >= pScanRes->rssi)
+        {
+            return;
+        }
+
+        /* Unlink the evicted entry from its hash chain. */
+        pLink = &scanResultCache.hashHead[bssfindCacheHash(scanResultCache.bssDescr[entry].bssid.addr)];
+        steps = 0;
+
+        while ((entry != *pLink) && (*pLink < scanResultCache.numDescrs) && (steps < scanResultCache.numDescrs))
+        {
+            pLink = &scanResultCache.hashNext[*pLink];
+            steps++;
+        }
+
+        if (entry == *pLink)
+        {
+            *pLink = scanResultCache.hashNext[entry];
+        }
+        else
+        {
+            /* Hash index is inconsistent, rebuild it from scratch. */
+            WDRV_WINC_BSSFindCacheReset();
+
+            entry = 0;
+            scanResultCache.numDescrs = 1;
+        }
+    }
+
+    (void)memcpy(&scanResultCache.bssDescr[entry], pScanRes, sizeof(DRV_WINC_SCAN_RESULTS));
+
+    scanResultCache.hashNext[entry] = scanResultCache.hashHead[hash];
+    scanResultCache.hashHead[hash]  = entry;
+
+    bssfindCacheOrderInsert(entry, scanResultCache.numDescrs - 1U);
+}
+
 
 //*******************************************************************************
 /*
@@ -391,26 +661,25 @@ void WDRV_WINC_WSCNProcessAEC(uintptr_t context, WINC_DEVICE_HANDLE devHandle, c
     {
         case WINC_AEC_ID_WSCNIND:
         {
+            DRV_WINC_SCAN_RESULTS scanRes;
+
             if (5U != pElems->numElems)
             {
                 break;
             }
 
-            if (scanResultCache.numDescrs < WDRV_WINC_SCAN_RESULT_CACHE_NUM_ENTRIES)
-            {
-                DRV_WINC_SCAN_RESULTS *pScanRes = &scanResultCache.bssDescr[scanResultCache.numDescrs];
+            (void)memset(&scanRes, 0, sizeof(DRV_WINC_SCAN_RESULTS));
 
-                (void)WINC_CmdReadParamElem(&pElems->elems[0], WINC_TYPE_INTEGER, &pScanRes->rssi, sizeof(pScanRes->rssi));
-                (void)WINC_CmdReadParamElem(&pElems->elems[1], WINC_TYPE_INTEGER, &pScanRes->authTypeRecommended, sizeof(pScanRes->authTypeRecommended));
-                (void)WINC_CmdReadParamElem(&pElems->elems[2], WINC_TYPE_INTEGER, &pScanRes->channel, sizeof(pScanRes->channel));
-                (void)WINC_CmdReadParamElem(&pElems->elems[3], WINC_TYPE_MACADDR, pScanRes->bssid.addr, WDRV_WINC_MAC_ADDR_LEN);
-                (void)WINC_CmdReadParamElem(&pElems->elems[4], WINC_TYPE_STRING,  pScanRes->ssid.name, WDRV_WINC_MAX_SSID_LEN);
+            (void)WINC_CmdReadParamElem(&pElems->elems[0], WINC_TYPE_INTEGER, &scanRes.rssi, sizeof(scanRes.rssi));
+            (void)WINC_CmdReadParamElem(&pElems->elems[1], WINC_TYPE_INTEGER, &scanRes.authTypeRecommended, sizeof(scanRes.authTypeRecommended));
+            (void)WINC_CmdReadParamElem(&pElems->elems[2], WINC_TYPE_INTEGER, &scanRes.channel, sizeof(scanRes.channel));
+            (void)WINC_CmdReadParamElem(&pElems->elems[3], WINC_TYPE_MACADDR, scanRes.bssid.addr, WDRV_WINC_MAC_ADDR_LEN);
+            (void)WINC_CmdReadParamElem(&pElems->elems[4], WINC_TYPE_STRING,  scanRes.ssid.name, WDRV_WINC_MAX_SSID_LEN);
 
-                pScanRes->bssid.valid = true;
-                pScanRes->ssid.length = (uint8_t)pElems->elems[4].length;
+            scanRes.bssid.valid = true;
+            scanRes.ssid.length = (uint8_t)pElems->elems[4].length;
 
-                scanResultCache.numDescrs++;
-            }
+            bssfindCacheInsert(&scanRes);
 
             break;
         }
@@ -540,7 +809,7 @@ WDRV_WINC_STATUS WDRV_WINC_BSSFindFirst
         }
     }
 
-    scanResultCache.numDescrs = 0;
+    WDRV_WINC_BSSFindCacheReset();
 
     cmdReqHandle = WDRV_WINC_CmdReqInit((unsigned int)5+numSSIDInList, ssidListSize, bssfindWSCNCmdRspCallbackHandler, (uintptr_t)pDcpt);
 
@@ -768,7 +1037,7 @@ WDRV_WINC_STATUS WDRV_WINC_BSSFindGetInfo
         return WDRV_WINC_STATUS_NO_BSS_INFO;
     }
 
-    pLastBSSScanInfo = &scanResultCache.bssDescr[pDcpt->pCtrl->scanIndex];
+    pLastBSSScanInfo = &scanResultCache.bssDescr[scanResultCache.order[pDcpt->pCtrl->scanIndex]];
 
     if (0U == scanResultCache.numDescrs)
     {
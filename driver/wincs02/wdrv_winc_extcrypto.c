@@ -235,6 +235,245 @@ static WDRV_WINC_EXTCRYPTO_SIG_ALGO extCryptoEcdsaCurveToSigAlgo(uint8_t curveId
 
     return sigAlg;
 }
+
+//*******************************************************************************
+/*
+  Function:
+    static bool extCryptoSignRelease(WDRV_WINC_DCPT *pDcpt, uint16_t extCryptoCxt)
+
+  Summary:
+    Release a signing queue entry.
+
+  Description:
+    Removes the request with the external crypto context from the signing queue.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pDcpt        - Pointer to WINC device descriptor.
+    extCryptoCxt - External crypto context of the request.
+
+  Returns:
+    true if the request was found in the queue, false otherwise.
+
+  Remarks:
+    None.
+
+*/
+
+static bool extCryptoSignRelease(WDRV_WINC_DCPT *pDcpt, uint16_t extCryptoCxt)
+{
+    WDRV_WINC_EXTCRYPTO_SIGN_QUEUE *pQueue = &pDcpt->pCtrl->extCryptoSignQueue;
+    unsigned int i;
+
+    for (i=0; i<WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM; i++)
+    {
+        if ((true == pQueue->entries[i].inUse) && (extCryptoCxt == pQueue->entries[i].extCryptoCxt))
+        {
+            if (true == pQueue->entries[i].dispatched)
+            {
+                pQueue->numOutstanding--;
+            }
+
+            pQueue->entries[i].inUse = false;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void extCryptoSignDispatch(WDRV_WINC_DCPT *pDcpt)
+
+  Summary:
+    Dispatch queued signing requests.
+
+  Description:
+    Passes queued signing requests to the signer, in order of arrival, until
+      the maximum number outstanding is reached.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pDcpt - Pointer to WINC device descriptor.
+
+  Returns:
+    None.
+
+  Remarks:
+    The signer may provide its result from within the call, the dispatching
+      flag prevents this from re-entering the dispatch loop.
+
+*/
+
+static void extCryptoSignDispatch(WDRV_WINC_DCPT *pDcpt)
+{
+    WDRV_WINC_EXTCRYPTO_SIGN_QUEUE *pQueue = &pDcpt->pCtrl->extCryptoSignQueue;
+
+    if (true == pQueue->dispatching)
+    {
+        return;
+    }
+
+    pQueue->dispatching = true;
+
+    while (pQueue->numOutstanding < pQueue->maxOutstanding)
+    {
+        WDRV_WINC_EXTCRYPTO_SIGN_ENTRY *pEntry = NULL;
+        const WDRV_WINC_TLSCTX_INFO *pTlsCtx;
+        WDRV_WINC_EXTCRYPTO_SIGN_CB pfSignCB;
+        unsigned int i;
+
+        for (i=0; i<WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM; i++)
+        {
+            if ((true == pQueue->entries[i].inUse) && (false == pQueue->entries[i].dispatched))
+            {
+                if ((NULL == pEntry) || ((int32_t)(pQueue->entries[i].seqNum - pEntry->seqNum) < 0))
+                {
+                    pEntry = &pQueue->entries[i];
+                }
+            }
+        }
+
+        if (NULL == pEntry)
+        {
+            break;
+        }
+
+        pTlsCtx  = &pDcpt->pCtrl->tlscInfo[pEntry->tlsHandle-1U];
+        pfSignCB = pQueue->pfSignCB;
+
+        if (NULL == pfSignCB)
+        {
+            pfSignCB = pTlsCtx->pfSignCB;
+        }
+
+        pEntry->dispatched = true;
+        pQueue->numOutstanding++;
+
+        if (NULL == pfSignCB)
+        {
+            (void)WDRV_WINC_EXTCRYPTOSignResult((DRV_HANDLE)pDcpt, pEntry->extCryptoCxt, false, NULL, 0);
+        }
+        else
+        {
+            pfSignCB((DRV_HANDLE)pDcpt, pTlsCtx->signCbCtx, pEntry->signAlgo,
+                        pEntry->signValue, pEntry->signValueLen, pEntry->extCryptoCxt);
+        }
+    }
+
+    pQueue->dispatching = false;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void extCryptoSignEnqueue
+    (
+        WDRV_WINC_DCPT *pDcpt,
+        uint16_t extCryptoCxt,
+        const WINC_DEV_EVENT_RSP_ELEMS *const pElems
+    )
+
+  Summary:
+    Queue a signing request.
+
+  Description:
+    Adds a signing request received from the WINC to the signing queue.
+
+  Precondition:
+    The signing queue must be enabled.
+
+  Parameters:
+    pDcpt        - Pointer to WINC device descriptor.
+    extCryptoCxt - External crypto context of the request.
+    pElems       - Pointer to AEC elements of the request.
+
+  Returns:
+    None.
+
+  Remarks:
+    If the queue is full, or the value is too long, a failure result is
+      returned to the WINC.
+
+*/
+
+static void extCryptoSignEnqueue
+(
+    WDRV_WINC_DCPT *pDcpt,
+    uint16_t extCryptoCxt,
+    const WINC_DEV_EVENT_RSP_ELEMS *const pElems
+)
+{
+    WDRV_WINC_EXTCRYPTO_SIGN_QUEUE *pQueue = &pDcpt->pCtrl->extCryptoSignQueue;
+    WDRV_WINC_EXTCRYPTO_SIGN_ENTRY *pEntry = NULL;
+    WDRV_WINC_EXTCRYPTO_SIG_ALGO signAlgo;
+    uint8_t opSrcType;
+    uint8_t opSrcId;
+    uint8_t signType;
+    uint8_t curveId;
+    unsigned int i;
+
+    (void)WINC_CmdReadParamElem(&pElems->elems[2], WINC_TYPE_INTEGER_UNSIGNED, &opSrcType, sizeof(opSrcType));
+    (void)WINC_CmdReadParamElem(&pElems->elems[3], WINC_TYPE_INTEGER_UNSIGNED, &opSrcId, sizeof(opSrcId));
+    (void)WINC_CmdReadParamElem(&pElems->elems[4], WINC_TYPE_INTEGER_UNSIGNED, &signType, sizeof(signType));
+    (void)WINC_CmdReadParamElem(&pElems->elems[5], WINC_TYPE_INTEGER_UNSIGNED, &curveId, sizeof(curveId));
+
+    if ((WINC_CONST_EXTCRYPTO_OP_SOURCE_TYPE_TLSC != opSrcType) || (WINC_CONST_EXTCRYPTO_SIGN_TYPE_ECDSA != signType))
+    {
+        return;
+    }
+
+    if ((WDRV_WINC_TLS_INVALID_HANDLE == opSrcId) || (opSrcId > WDRV_WINC_TLS_CTX_NUM))
+    {
+        return;
+    }
+
+    signAlgo = extCryptoEcdsaCurveToSigAlgo(curveId);
+
+    if (WDRV_WINC_EXTCRYPTO_SIG_ALGO_INVALID == signAlgo)
+    {
+        return;
+    }
+
+    if (pElems->elems[6].length <= WDRV_WINC_EXTCRYPTO_SIGN_VALUE_MAX_LEN)
+    {
+        for (i=0; i<WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM; i++)
+        {
+            if (false == pQueue->entries[i].inUse)
+            {
+                pEntry = &pQueue->entries[i];
+                break;
+            }
+        }
+    }
+
+    if (NULL == pEntry)
+    {
+        (void)WDRV_WINC_EXTCRYPTOSignResult((DRV_HANDLE)pDcpt, extCryptoCxt, false, NULL, 0);
+        return;
+    }
+
+    (void)WINC_CmdReadParamElem(&pElems->elems[6], WINC_TYPE_BYTE_ARRAY, pEntry->signValue, pElems->elems[6].length);
+
+    pEntry->inUse        = true;
+    pEntry->dispatched   = false;
+    pEntry->extCryptoCxt = extCryptoCxt;
+    pEntry->tlsHandle    = opSrcId;
+    pEntry->signValueLen = (uint8_t)pElems->elems[6].length;
+    pEntry->signAlgo     = signAlgo;
+    pEntry->seqNum       = pQueue->nextSeqNum;
+
+    pQueue->nextSeqNum++;
+
+    extCryptoSignDispatch(pDcpt);
+}
 #endif
 
 //*******************************************************************************
@@ -302,6 +541,14 @@ void WDRV_WINC_EXTCRYPTOProcessAEC
                         break;
                     }
 
+#ifndef WDRV_WINC_MOD_DISABLE_TLS
+                    if (0U != pDcpt->pCtrl->extCryptoSignQueue.maxOutstanding)
+                    {
+                        extCryptoSignEnqueue(pDcpt, extCryptoCxt, pElems);
+                        break;
+                    }
+#endif
+
                     pSignValue = OSAL_Malloc(pElems->elems[6].length);
 
                     if (NULL == pSignValue)
@@ -421,6 +668,14 @@ WDRV_WINC_STATUS WDRV_WINC_EXTCRYPTOSignResult
         return WDRV_WINC_STATUS_NOT_OPEN;
     }
 
+#ifndef WDRV_WINC_MOD_DISABLE_TLS
+    /* Release the request from the signing queue and pass on the next one. */
+    if (true == extCryptoSignRelease(pDcpt, (uint16_t)extCryptoCxt))
+    {
+        extCryptoSignDispatch(pDcpt);
+    }
+#endif
+
     cmdReqHandle = WDRV_WINC_CmdReqInit(1, lenSignature, extCryptoEXTCRYPTOCmdRspCallbackHandler, (uintptr_t)pDcpt);
 
     if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
@@ -437,3 +692,64 @@ WDRV_WINC_STATUS WDRV_WINC_EXTCRYPTOSignResult
 
     return WDRV_WINC_STATUS_OK;
 }
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_EXTCRYPTOSignQueueConfigure
+    (
+        DRV_HANDLE handle,
+        WDRV_WINC_EXTCRYPTO_SIGN_CB pfSignCB,
+        uint8_t maxOutstanding
+    )
+
+  Summary:
+    Configures the external signing queue.
+
+  Description:
+    Enables queuing of signing requests received from the WINC.
+
+  Remarks:
+    See wdrv_winc_extcrypto.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_EXTCRYPTOSignQueueConfigure
+(
+    DRV_HANDLE handle,
+    WDRV_WINC_EXTCRYPTO_SIGN_CB pfSignCB,
+    uint8_t maxOutstanding
+)
+{
+#ifndef WDRV_WINC_MOD_DISABLE_TLS
+    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT *)handle;
+    unsigned int i;
+
+    /* Ensure the driver handle is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    for (i=0; i<WDRV_WINC_EXTCRYPTO_SIGN_QUEUE_NUM; i++)
+    {
+        if (true == pDcpt->pCtrl->extCryptoSignQueue.entries[i].inUse)
+        {
+            return WDRV_WINC_STATUS_BUSY;
+        }
+    }
+
+    pDcpt->pCtrl->extCryptoSignQueue.pfSignCB       = pfSignCB;
+    pDcpt->pCtrl->extCryptoSignQueue.maxOutstanding = maxOutstanding;
+
+    return WDRV_WINC_STATUS_OK;
+#else
+    return WDRV_WINC_STATUS_OPERATION_NOT_SUPPORTED;
+#endif
+}
@@ -50,6 +50,7 @@ Microchip or any third party.
 #include "wdrv_winc_file.h"
 
 static bool fileLoadBuffer(WDRV_WINC_DCPT *pDcpt, WDRV_WINC_FILE_CTX *pFileCtx, bool forceFlushClose);
+static void fileWriteCompleteCheck(WDRV_WINC_DCPT *pDcpt, WDRV_WINC_FILE_CTX *pFileCtx);
 
 // *****************************************************************************
 // *****************************************************************************
@@ -546,26 +547,19 @@ static void fileCmdRspCallbackHandler
                         (void)WINC_CmdReadParamElem(&pRspElems->elems[1], WINC_TYPE_INTEGER, &blockNum, sizeof(blockNum));
                         (void)WINC_CmdReadParamElem(&pRspElems->elems[2], WINC_TYPE_INTEGER, &remaining, sizeof(remaining));
 
-                        /* Check that the received block number is the one expected. */
-                        if (blockNum == pFileCtx->op.load.blockNum)
+                        /* Acknowledgements are cumulative, check the block number is within the
+                         range of blocks currently in flight. */
+                        if (((uint8_t)(blockNum - pFileCtx->op.load.ackBlockNum) > 0U) &&
+                            ((uint8_t)(blockNum - pFileCtx->op.load.ackBlockNum) <= (uint8_t)(pFileCtx->op.load.blockNum - pFileCtx->op.load.ackBlockNum)))
                         {
-                            /* Block has been ACK'd, remove the buffered data for refill. */
-                            pFileCtx->op.load.bufLen = 0;
+                            /* Blocks up to this one have been ACK'd, open the window. */
+                            pFileCtx->op.load.ackBlockNum = (uint8_t)blockNum;
 
-                            /* Refill internal buffer if pending data exists. */
-                            (void)fileLoadBuffer(pDcpt, pFileCtx, false);
+                            /* Send further blocks if pending data exists, or flush the
+                             final partial block of a closing transfer. */
+                            (void)fileLoadBuffer(pDcpt, pFileCtx, pFileCtx->close);
 
-                            if (NULL == pFileCtx->op.load.pData)
-                            {
-                                /* The supplied user buffer has been consumed. */
-                                if (NULL != pFileCtx->pfFileStatusCb)
-                                {
-                                    /* Call the user callback to indicate the supplied
-                                     buffer is complete and new data can be written if
-                                     required. */
-                                    pFileCtx->pfFileStatusCb((DRV_HANDLE)pDcpt, (WDRV_WINC_FILE_HANDLE)pFileCtx, pFileCtx->fileStatusCbCtx, WDRV_WINC_FILE_STATUS_WRITE_COMPLETE);
-                                }
-                            }
+                            fileWriteCompleteCheck(pDcpt, pFileCtx);
 
                             if (0U == remaining)
                             {
@@ -615,8 +609,10 @@ static void fileCmdRspCallbackHandler
     Load internal buffer and flush to WINC device.
 
   Description:
-    Data from a user supplied buffer is copied to a internal buffer, when
-    full this is flushed to the WINC via AT+FSTSFR,
+    Whole blocks from a user supplied buffer are sent directly to the WINC
+    via AT+FSTSFR, up to WDRV_WINC_FILE_TSFR_WINDOW blocks may be awaiting
+    acknowledgement. Any short tail is copied to the internal buffer and
+    flushed once full or when a flush is forced.
 
   Precondition:
     WDRV_WINC_Initialize must have been called.
@@ -630,6 +626,7 @@ static void fileCmdRspCallbackHandler
     true or false indicating success or error.
 
   Remarks:
+    All blocks sent by one call are placed in a single command request.
 
 */
 
@@ -640,15 +637,35 @@ static bool fileLoadBuffer
     bool forceFlushClose
 )
 {
+    const uint8_t *pBlock[WDRV_WINC_FILE_TSFR_WINDOW];
+    uint8_t lenBlock[WDRV_WINC_FILE_TSFR_WINDOW];
+    uint8_t numBlocks = 0;
+    uint8_t window;
+    size_t lenTotal = 0;
+    bool bufQueued = false;
+    const uint8_t *pData;
+    size_t lenData;
+    const uint8_t *pDataIn;
+    size_t lenDataIn;
+    uint8_t bufLenIn;
+
     if ((NULL == pDcpt) || (NULL == pFileCtx) || (NULL == pDcpt->pCtrl))
     {
         return false;
     }
 
-    if (NULL != pFileCtx->op.load.pData)
+    /* State to restore if the blocks cannot be sent. */
+    pDataIn   = pFileCtx->op.load.pData;
+    lenDataIn = pFileCtx->op.load.lenData;
+    bufLenIn  = pFileCtx->op.load.bufLen;
+
+    /* Number of blocks which can be sent before an acknowledgement is required. */
+    window = WDRV_WINC_FILE_TSFR_WINDOW - (uint8_t)(pFileCtx->op.load.blockNum - pFileCtx->op.load.ackBlockNum);
+
+    if ((NULL != pFileCtx->op.load.pData) && (pFileCtx->op.load.bufLen > 0U))
     {
-        /* Check if there is a user supplied buffer provided by WDRV_WINC_FileWrite
-         and there is space available in the internal buffer. */
+        /* The internal buffer holds a partial block, top it up from the user
+         buffer first to preserve data ordering. */
         if (pFileCtx->op.load.bufLen < WDRV_WINC_FILE_LOAD_BUF_SZ)
         {
             uint8_t bufFreeSpace = WDRV_WINC_FILE_LOAD_BUF_SZ - pFileCtx->op.load.bufLen;
@@ -674,29 +691,163 @@ static bool fileLoadBuffer
         }
     }
 
-    /* Check if the internal buffer is full, or partially full with an override to flush. */
-    if ((WDRV_WINC_FILE_LOAD_BUF_SZ == pFileCtx->op.load.bufLen) || ((true == forceFlushClose) && (pFileCtx->op.load.bufLen > 0U)))
+    /* Queue the internal buffer if it is full, or partially full with an override to flush. */
+    if ((window > 0U) && ((WDRV_WINC_FILE_LOAD_BUF_SZ == pFileCtx->op.load.bufLen) || ((true == forceFlushClose) && (pFileCtx->op.load.bufLen > 0U))))
+    {
+        pBlock[numBlocks]   = pFileCtx->op.load.buffer;
+        lenBlock[numBlocks] = pFileCtx->op.load.bufLen;
+        lenTotal += pFileCtx->op.load.bufLen;
+        numBlocks++;
+
+        bufQueued = true;
+    }
+
+    /* Queue whole blocks directly from the user buffer while the window allows,
+     the user buffer position is only advanced once the blocks are sent. */
+    pData   = pFileCtx->op.load.pData;
+    lenData = pFileCtx->op.load.lenData;
+
+    if ((0U == pFileCtx->op.load.bufLen) || (true == bufQueued))
+    {
+        while ((numBlocks < window) && (NULL != pData) && (lenData >= WDRV_WINC_FILE_LOAD_BUF_SZ))
+        {
+            pBlock[numBlocks]   = pData;
+            lenBlock[numBlocks] = WDRV_WINC_FILE_LOAD_BUF_SZ;
+            lenTotal += WDRV_WINC_FILE_LOAD_BUF_SZ;
+            numBlocks++;
+
+            pData   += WDRV_WINC_FILE_LOAD_BUF_SZ;
+            lenData -= WDRV_WINC_FILE_LOAD_BUF_SZ;
+
+            if (0U == lenData)
+            {
+                pData = NULL;
+            }
+        }
+    }
+
+    if (numBlocks > 0U)
     {
         WINC_CMD_REQ_HANDLE cmdReqHandle;
+        uint8_t blockNum = pFileCtx->op.load.blockNum;
+        uint8_t i;
 
-        cmdReqHandle = WDRV_WINC_CmdReqInit(1, pFileCtx->op.load.bufLen, fileCmdRspCallbackHandler, (uintptr_t)pDcpt);
+        cmdReqHandle = WDRV_WINC_CmdReqInit(numBlocks, lenTotal, fileCmdRspCallbackHandler, (uintptr_t)pDcpt);
 
         if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
         {
+            /* Undo any top up of the internal buffer so no data is lost. */
+            pFileCtx->op.load.pData   = pDataIn;
+            pFileCtx->op.load.lenData = lenDataIn;
+            pFileCtx->op.load.bufLen  = bufLenIn;
             return false;
         }
 
-        (void)WINC_CmdFSTSFR(cmdReqHandle, pFileCtx->tsfrHandle, ++pFileCtx->op.load.blockNum, pFileCtx->op.load.buffer, pFileCtx->op.load.bufLen, -1);
+        for (i=0; i<numBlocks; i++)
+        {
+            (void)WINC_CmdFSTSFR(cmdReqHandle, pFileCtx->tsfrHandle, ++blockNum, pBlock[i], lenBlock[i], -1);
+        }
 
         if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
         {
+            pFileCtx->op.load.pData   = pDataIn;
+            pFileCtx->op.load.lenData = lenDataIn;
+            pFileCtx->op.load.bufLen  = bufLenIn;
             return false;
         }
+
+        /* The block data has been copied into the command request. */
+        pFileCtx->op.load.blockNum = blockNum;
+        pFileCtx->op.load.pData    = pData;
+        pFileCtx->op.load.lenData  = lenData;
+
+        if (true == bufQueued)
+        {
+            pFileCtx->op.load.bufLen = 0;
+        }
+    }
+
+    /* Retain a short tail in the internal buffer until more data arrives. */
+    if ((NULL != pFileCtx->op.load.pData) && (0U == pFileCtx->op.load.bufLen) && (pFileCtx->op.load.lenData < WDRV_WINC_FILE_LOAD_BUF_SZ))
+    {
+        (void)memcpy(pFileCtx->op.load.buffer, pFileCtx->op.load.pData, pFileCtx->op.load.lenData);
+
+        pFileCtx->op.load.bufLen  = (uint8_t)pFileCtx->op.load.lenData;
+        pFileCtx->op.load.lenData = 0;
+        pFileCtx->op.load.pData   = NULL;
+    }
+
+    /* Once the user buffer is released the current write completes when the
+     last block sent so far is acknowledged. */
+    if ((true == pFileCtx->op.load.writePending) && (NULL != pDataIn) && (NULL == pFileCtx->op.load.pData))
+    {
+        pFileCtx->op.load.writeBlockNum = pFileCtx->op.load.blockNum;
     }
 
     return true;
 }
 
+//*******************************************************************************
+/*
+  Function:
+    static void fileWriteCompleteCheck
+    (
+        WDRV_WINC_DCPT *pDcpt,
+        WDRV_WINC_FILE_CTX *pFileCtx
+    )
+
+  Summary:
+    Report completion of a file write.
+
+  Description:
+    Calls the user callback with WDRV_WINC_FILE_STATUS_WRITE_COMPLETE once the
+    user buffer has been released and every block holding its data has been
+    acknowledged by the WINC.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pDcpt    - Pointer to WINC device descriptor.
+    pFileCtx - Pointer to file transfer context.
+
+  Returns:
+    None.
+
+  Remarks:
+    Completion is reported once per call to WDRV_WINC_FileWrite.
+
+*/
+
+static void fileWriteCompleteCheck
+(
+    WDRV_WINC_DCPT *pDcpt,
+    WDRV_WINC_FILE_CTX *pFileCtx
+)
+{
+    if ((false == pFileCtx->op.load.writePending) || (NULL != pFileCtx->op.load.pData))
+    {
+        return;
+    }
+
+    /* The write block is outstanding while it lies between the acknowledged
+     block and the last block sent. */
+    if (((uint8_t)(pFileCtx->op.load.writeBlockNum - pFileCtx->op.load.ackBlockNum) > 0U) &&
+        ((uint8_t)(pFileCtx->op.load.writeBlockNum - pFileCtx->op.load.ackBlockNum) <= (uint8_t)(pFileCtx->op.load.blockNum - pFileCtx->op.load.ackBlockNum)))
+    {
+        return;
+    }
+
+    pFileCtx->op.load.writePending = false;
+
+    if (NULL != pFileCtx->pfFileStatusCb)
+    {
+        /* Call the user callback to indicate the supplied buffer is complete
+         and new data can be written if required. */
+        pFileCtx->pfFileStatusCb((DRV_HANDLE)pDcpt, (WDRV_WINC_FILE_HANDLE)pFileCtx, pFileCtx->fileStatusCbCtx, WDRV_WINC_FILE_STATUS_WRITE_COMPLETE);
+    }
+}
+
 //*******************************************************************************
 /*
   Function:
@@ -856,7 +1007,7 @@ WDRV_WINC_STATUS WDRV_WINC_FileClose
         return WDRV_WINC_STATUS_REQUEST_ERROR;
     }
 
-    if ((0U == pFileCtx->op.load.bufLen) && (0U == pFileCtx->op.load.lenData))
+    if ((0U == pFileCtx->op.load.bufLen) && (0U == pFileCtx->op.load.lenData) && (pFileCtx->op.load.blockNum == pFileCtx->op.load.ackBlockNum))
     {
         if (NULL != pFileCtx->pfFileStatusCb)
         {
@@ -934,14 +1085,23 @@ WDRV_WINC_STATUS WDRV_WINC_FileWrite
         return WDRV_WINC_STATUS_NOT_OPEN;
     }
 
-    pFileCtx->op.load.pData   = pData;
-    pFileCtx->op.load.lenData = lenData;
+    pFileCtx->op.load.pData         = pData;
+    pFileCtx->op.load.lenData       = lenData;
+    pFileCtx->op.load.writeBlockNum = pFileCtx->op.load.blockNum;
+    pFileCtx->op.load.writePending  = true;
 
     if (false == fileLoadBuffer(pDcpt, pFileCtx, false))
     {
+        /* Nothing was taken from the user buffer, the write can be retried. */
+        pFileCtx->op.load.pData        = NULL;
+        pFileCtx->op.load.lenData      = 0;
+        pFileCtx->op.load.writePending = false;
+
         return WDRV_WINC_STATUS_REQUEST_ERROR;
     }
 
+    fileWriteCompleteCheck(pDcpt, pFileCtx);
+
     return WDRV_WINC_STATUS_OK;
 }
 
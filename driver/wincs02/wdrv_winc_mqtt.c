@@ -65,6 +65,358 @@ static const WDRV_WINC_MQTT_MSG_INFO defaultQoS0MsgInfo =
 // *****************************************************************************
 // *****************************************************************************
 
+//*******************************************************************************
+/*
+  Function:
+    static WDRV_WINC_MQTT_PUB_ENTRY* mqttPubFindHandle
+    (
+        WDRV_WINC_CTRLDCPT *pCtrl,
+        WDRV_WINC_MQTT_PUB_HANDLE pubHandle,
+        uint8_t cmdIdx
+    )
+
+  Summary:
+    Find a publish table entry using the publish handle.
+
+  Description:
+    Search the publish table for an in use entry with a matching handle and
+    command index within the command request.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pCtrl     - Pointer to driver control structure.
+    pubHandle - Publish handle to find.
+    cmdIdx    - Index of the MQTTPUB command within the command request.
+
+  Returns:
+    Pointer to publish table entry or NULL if not found.
+
+  Remarks:
+    None.
+
+*/
+
+static WDRV_WINC_MQTT_PUB_ENTRY* mqttPubFindHandle
+(
+    WDRV_WINC_CTRLDCPT *pCtrl,
+    WDRV_WINC_MQTT_PUB_HANDLE pubHandle,
+    uint8_t cmdIdx
+)
+{
+    unsigned int i;
+
+    for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+    {
+        if ((true == pCtrl->mqtt.pubTable[i].inUse) && (pubHandle == pCtrl->mqtt.pubTable[i].pubHandle) && (cmdIdx == pCtrl->mqtt.pubTable[i].cmdIdx))
+        {
+            return &pCtrl->mqtt.pubTable[i];
+        }
+    }
+
+    return NULL;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static WDRV_WINC_MQTT_PUB_ENTRY* mqttPubFindPacketId
+    (
+        WDRV_WINC_CTRLDCPT *pCtrl,
+        uint16_t packetId
+    )
+
+  Summary:
+    Find a publish table entry using the packet ID.
+
+  Description:
+    Search the publish table for an in use entry with a matching packet ID.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pCtrl    - Pointer to driver control structure.
+    packetId - Packet ID to find.
+
+  Returns:
+    Pointer to publish table entry or NULL if not found.
+
+  Remarks:
+    Only entries whose packet ID has been reported by the WINC are matched.
+
+*/
+
+static WDRV_WINC_MQTT_PUB_ENTRY* mqttPubFindPacketId
+(
+    WDRV_WINC_CTRLDCPT *pCtrl,
+    uint16_t packetId
+)
+{
+    unsigned int i;
+
+    for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+    {
+        if ((true == pCtrl->mqtt.pubTable[i].inUse) && (true == pCtrl->mqtt.pubTable[i].packetIdValid) && (packetId == pCtrl->mqtt.pubTable[i].packetId))
+        {
+            return &pCtrl->mqtt.pubTable[i];
+        }
+    }
+
+    return NULL;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static WDRV_WINC_MQTT_PUB_ENTRY* mqttPubFindFree(WDRV_WINC_CTRLDCPT *pCtrl)
+
+  Summary:
+    Find a free publish table entry.
+
+  Description:
+    Search the publish table for an entry which is not in use.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pCtrl - Pointer to driver control structure.
+
+  Returns:
+    Pointer to publish table entry or NULL if the table is full.
+
+  Remarks:
+    None.
+
+*/
+
+static WDRV_WINC_MQTT_PUB_ENTRY* mqttPubFindFree(WDRV_WINC_CTRLDCPT *pCtrl)
+{
+    unsigned int i;
+
+    for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+    {
+        if (false == pCtrl->mqtt.pubTable[i].inUse)
+        {
+            return &pCtrl->mqtt.pubTable[i];
+        }
+    }
+
+    return NULL;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static bool mqttPubAwaitingPacketId(const WDRV_WINC_CTRLDCPT *pCtrl)
+
+  Summary:
+    Check for publishes awaiting a packet ID.
+
+  Description:
+    Search the publish table for an in use QoS 1 or 2 entry whose packet ID
+    has not yet been reported by the WINC.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pCtrl - Pointer to driver control structure.
+
+  Returns:
+    true if an entry is awaiting its packet ID, otherwise false.
+
+  Remarks:
+    None.
+
+*/
+
+static bool mqttPubAwaitingPacketId(const WDRV_WINC_CTRLDCPT *pCtrl)
+{
+    unsigned int i;
+
+    for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+    {
+        const WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry = &pCtrl->mqtt.pubTable[i];
+
+        if ((true == pPubEntry->inUse) && (false == pPubEntry->packetIdValid) && (WDRV_WINC_MQTT_QOS_0 != pPubEntry->qos))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static bool mqttPubEarlyAckTake
+    (
+        WDRV_WINC_CTRLDCPT *pCtrl,
+        uint16_t packetId,
+        WDRV_WINC_MQTT_PUB_STATUS_TYPE *pStatus
+    )
+
+  Summary:
+    Claim an acknowledgement which arrived ahead of its packet ID.
+
+  Description:
+    Search the early acknowledgements for the packet ID and release it.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pCtrl    - Pointer to driver control structure.
+    packetId - Packet ID just reported for a publish.
+    pStatus  - Pointer to receive the acknowledgement status.
+
+  Returns:
+    true if an acknowledgement was found, otherwise false.
+
+  Remarks:
+    None.
+
+*/
+
+static bool mqttPubEarlyAckTake
+(
+    WDRV_WINC_CTRLDCPT *pCtrl,
+    uint16_t packetId,
+    WDRV_WINC_MQTT_PUB_STATUS_TYPE *pStatus
+)
+{
+    unsigned int i;
+
+    for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+    {
+        WDRV_WINC_MQTT_PUB_EARLY_ACK *pEarlyAck = &pCtrl->mqtt.pubEarlyAck[i];
+
+        if ((true == pEarlyAck->valid) && (packetId == pEarlyAck->packetId))
+        {
+            *pStatus = pEarlyAck->status;
+            pEarlyAck->valid = false;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void mqttPubBatchRelease
+    (
+        WDRV_WINC_MQTT_PUB_ENTRY *const *ppPubEntry,
+        size_t numEntries
+    )
+
+  Summary:
+    Release publish table entries reserved for a batch.
+
+  Description:
+    Clears each reserved entry of a batch which could not be sent.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    ppPubEntry - Pointer to array of entry pointers, NULL if not reserved.
+    numEntries - Number of entry pointers in the array.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+
+*/
+
+static void mqttPubBatchRelease
+(
+    WDRV_WINC_MQTT_PUB_ENTRY *const *ppPubEntry,
+    size_t numEntries
+)
+{
+    size_t i;
+
+    for (i=0; i<numEntries; i++)
+    {
+        if (NULL != ppPubEntry[i])
+        {
+            (void)memset(ppPubEntry[i], 0, sizeof(WDRV_WINC_MQTT_PUB_ENTRY));
+        }
+    }
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void mqttPubComplete
+    (
+        WDRV_WINC_DCPT *pDcpt,
+        WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry,
+        WDRV_WINC_MQTT_PUB_HANDLE pubHandle,
+        WDRV_WINC_MQTT_PUB_STATUS_TYPE status
+    )
+
+  Summary:
+    Complete a publish table entry.
+
+  Description:
+    Calls the entry's status callback and releases the entry.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pDcpt     - Pointer to WINC device descriptor.
+    pPubEntry - Pointer to publish table entry.
+    pubHandle - Publish handle to report to the callback.
+    status    - Final status of the publish.
+
+  Returns:
+    None.
+
+  Remarks:
+    The entry is released before the callback so it may be reused from
+    within the callback.
+
+*/
+
+static void mqttPubComplete
+(
+    WDRV_WINC_DCPT *pDcpt,
+    WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry,
+    WDRV_WINC_MQTT_PUB_HANDLE pubHandle,
+    WDRV_WINC_MQTT_PUB_STATUS_TYPE status
+)
+{
+    WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb = pPubEntry->pfPubStatusCb;
+    uintptr_t pubStatusCbCtx = pPubEntry->pubStatusCbCtx;
+    uint16_t packetId = pPubEntry->packetId;
+
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+    if ((WDRV_WINC_MQTT_PUB_STATUS_ERROR == status) && (pPubEntry->topicAlias > 0U))
+    {
+        /* The alias may not have been registered, force it to be resent. */
+        (void)memset(&pDcpt->pCtrl->mqtt.topicAliasTable[pPubEntry->topicAlias-1U], 0, sizeof(WDRV_WINC_MQTT_TOPIC_ALIAS_ENTRY));
+    }
+#endif
+
+    (void)memset(pPubEntry, 0, sizeof(WDRV_WINC_MQTT_PUB_ENTRY));
+
+    if (NULL != pfPubStatusCb)
+    {
+        pfPubStatusCb((DRV_HANDLE)pDcpt, pubStatusCbCtx, pubHandle, packetId, status);
+    }
+}
+
 //*******************************************************************************
 /*
   Function:
@@ -161,6 +513,25 @@ static void mqttCmdRspCallbackHandler
 
         case WINC_DEV_CMDREQ_EVENT_STATUS_COMPLETE:
         {
+            unsigned int i;
+
+            /* Fail any publish from this request which never received its
+             packet ID, the handle is no longer valid once released. */
+            for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+            {
+                WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry = &pDcpt->pCtrl->mqtt.pubTable[i];
+
+                if ((true == pPubEntry->inUse) && ((WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle == pPubEntry->pubHandle))
+                {
+                    mqttPubComplete(pDcpt, pPubEntry, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, WDRV_WINC_MQTT_PUB_STATUS_ERROR);
+                }
+            }
+
+            if (false == mqttPubAwaitingPacketId(pDcpt->pCtrl))
+            {
+                (void)memset(pDcpt->pCtrl->mqtt.pubEarlyAck, 0, sizeof(pDcpt->pCtrl->mqtt.pubEarlyAck));
+            }
+
             OSAL_Free((WINC_COMMAND_REQUEST*)cmdReqHandle);
             break;
         }
@@ -179,9 +550,11 @@ static void mqttCmdRspCallbackHandler
                     {
                         if (WINC_STATUS_OK != pStatusInfo->status)
                         {
-                            if (NULL != pDcpt->pCtrl->mqtt.pfPubStatusCb)
+                            WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry = mqttPubFindHandle(pDcpt->pCtrl, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, pStatusInfo->srcCmd.idx);
+
+                            if (NULL != pPubEntry)
                             {
-                                pDcpt->pCtrl->mqtt.pfPubStatusCb((DRV_HANDLE)pDcpt, pDcpt->pCtrl->mqtt.pubStatusCbCtx, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, 0, WDRV_WINC_MQTT_PUB_STATUS_ERROR);
+                                mqttPubComplete(pDcpt, pPubEntry, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, WDRV_WINC_MQTT_PUB_STATUS_ERROR);
                             }
                         }
 
@@ -209,18 +582,47 @@ static void mqttCmdRspCallbackHandler
                     case WINC_CMD_ID_MQTTPUB:
                     {
                         uint16_t packetId;
-                        WDRV_WINC_MQTT_PUB_STATUS_TYPE pubStatus = WDRV_WINC_MQTT_PUB_STATUS_SENT;
+                        WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry;
 
                         if (1U != pRspElems->numElems)
                         {
                             break;
                         }
 
+                        pPubEntry = mqttPubFindHandle(pDcpt->pCtrl, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, pRspElems->srcCmd.idx);
+
+                        if (NULL == pPubEntry)
+                        {
+                            break;
+                        }
+
                         (void)WINC_CmdReadParamElem(&pRspElems->elems[0], WINC_TYPE_INTEGER, &packetId, sizeof(packetId));
 
-                        if (NULL != pDcpt->pCtrl->mqtt.pfPubStatusCb)
+                        pPubEntry->packetId = packetId;
+
+                        if (WDRV_WINC_MQTT_QOS_0 == pPubEntry->qos)
                         {
-                            pDcpt->pCtrl->mqtt.pfPubStatusCb((DRV_HANDLE)pDcpt, pDcpt->pCtrl->mqtt.pubStatusCbCtx, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, packetId, pubStatus);
+                            /* No acknowledgement will follow, the publish is complete. */
+                            mqttPubComplete(pDcpt, pPubEntry, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, WDRV_WINC_MQTT_PUB_STATUS_SENT);
+                        }
+                        else
+                        {
+                            WDRV_WINC_MQTT_PUB_STATUS_TYPE ackStatus;
+
+                            /* From now on the entry is matched by packet ID. */
+                            pPubEntry->packetIdValid = true;
+                            pPubEntry->pubHandle     = WDRV_WINC_MQTT_PUB_INVALID_HANDLE;
+
+                            if (NULL != pPubEntry->pfPubStatusCb)
+                            {
+                                pPubEntry->pfPubStatusCb((DRV_HANDLE)pDcpt, pPubEntry->pubStatusCbCtx, (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle, packetId, WDRV_WINC_MQTT_PUB_STATUS_SENT);
+                            }
+
+                            /* The acknowledgement may have overtaken this response. */
+                            if (true == mqttPubEarlyAckTake(pDcpt->pCtrl, packetId, &ackStatus))
+                            {
+                                mqttPubComplete(pDcpt, pPubEntry, WDRV_WINC_MQTT_PUB_INVALID_HANDLE, ackStatus);
+                            }
                         }
 
                         break;
@@ -306,6 +708,11 @@ void WDRV_WINC_MQTTProcessAEC
                     pDcpt->pCtrl->mqtt.connState = WDRV_WINC_MQTT_CONN_STATUS_CONNECTED;
 
                     (void)memset(&pDcpt->pCtrl->mqtt.pubProps, 0, sizeof(WDRV_WINC_MQTT_PUB_PROP));
+
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+                    /* Topic aliases only persist for a single connection. */
+                    (void)memset(pDcpt->pCtrl->mqtt.topicAliasTable, 0, sizeof(pDcpt->pCtrl->mqtt.topicAliasTable));
+#endif
                 }
             }
             else if (WDRV_WINC_MQTT_CONN_STATUS_CONNECTED == pDcpt->pCtrl->mqtt.connState)
@@ -329,6 +736,22 @@ void WDRV_WINC_MQTTProcessAEC
 
             if (prevConnState != pDcpt->pCtrl->mqtt.connState)
             {
+                if (WDRV_WINC_MQTT_CONN_STATUS_DISCONNECTED == pDcpt->pCtrl->mqtt.connState)
+                {
+                    unsigned int i;
+
+                    /* Fail any publishes still awaiting completion. */
+                    for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+                    {
+                        if (true == pDcpt->pCtrl->mqtt.pubTable[i].inUse)
+                        {
+                            mqttPubComplete(pDcpt, &pDcpt->pCtrl->mqtt.pubTable[i], pDcpt->pCtrl->mqtt.pubTable[i].pubHandle, WDRV_WINC_MQTT_PUB_STATUS_ERROR);
+                        }
+                    }
+
+                    (void)memset(pDcpt->pCtrl->mqtt.pubEarlyAck, 0, sizeof(pDcpt->pCtrl->mqtt.pubEarlyAck));
+                }
+
                 if (NULL != pDcpt->pCtrl->mqtt.pfConnCB)
                 {
                     pDcpt->pCtrl->mqtt.pfConnCB((DRV_HANDLE)pDcpt, pDcpt->pCtrl->mqtt.connCbCtx, pDcpt->pCtrl->mqtt.connState, &pDcpt->pCtrl->mqtt.connInfo);
@@ -359,6 +782,7 @@ void WDRV_WINC_MQTTProcessAEC
         case WINC_AEC_ID_MQTTPUBERR:
         {
             uint16_t packetId;
+            WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry;
             WDRV_WINC_MQTT_PUB_STATUS_TYPE pubStatus = WDRV_WINC_MQTT_PUB_STATUS_RECV;
 
             if (1U != pElems->numElems)
@@ -373,9 +797,36 @@ void WDRV_WINC_MQTTProcessAEC
 
             (void)WINC_CmdReadParamElem(&pElems->elems[0], WINC_TYPE_INTEGER, &packetId, sizeof(packetId));
 
-            if (NULL != pDcpt->pCtrl->mqtt.pfPubStatusCb)
+            /* Match the acknowledgement to the publish which was assigned this packet ID. */
+            pPubEntry = mqttPubFindPacketId(pDcpt->pCtrl, packetId);
+
+            if (NULL != pPubEntry)
             {
-                pDcpt->pCtrl->mqtt.pfPubStatusCb((DRV_HANDLE)pDcpt, pDcpt->pCtrl->mqtt.pubStatusCbCtx, WDRV_WINC_MQTT_PUB_INVALID_HANDLE, packetId, pubStatus);
+                mqttPubComplete(pDcpt, pPubEntry, WDRV_WINC_MQTT_PUB_INVALID_HANDLE, pubStatus);
+            }
+            else if (true == mqttPubAwaitingPacketId(pDcpt->pCtrl))
+            {
+                unsigned int i;
+                unsigned int slot = 0;
+
+                /* Hold the acknowledgement until the packet ID is reported,
+                 replacing the first slot if all are in use. */
+                for (i=0; i<WDRV_WINC_MQTT_PUB_NUM; i++)
+                {
+                    if (false == pDcpt->pCtrl->mqtt.pubEarlyAck[i].valid)
+                    {
+                        slot = i;
+                        break;
+                    }
+                }
+
+                pDcpt->pCtrl->mqtt.pubEarlyAck[slot].valid    = true;
+                pDcpt->pCtrl->mqtt.pubEarlyAck[slot].packetId = packetId;
+                pDcpt->pCtrl->mqtt.pubEarlyAck[slot].status   = pubStatus;
+            }
+            else
+            {
+                /* Acknowledgement for an untracked publish. */
             }
 
             break;
@@ -1133,60 +1584,231 @@ WDRV_WINC_STATUS WDRV_WINC_MQTTDisconnect
     return WDRV_WINC_STATUS_OK;
 }
 
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
 //*******************************************************************************
 /*
   Function:
-    WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
+    static uint16_t mqttTopicAliasResolve
     (
-        DRV_HANDLE handle,
+        WDRV_WINC_CTRLDCPT *pCtrl,
+        const char **ppTopicName
+    )
+
+  Summary:
+    Resolve a topic name to a driver managed topic alias.
+
+  Description:
+    Looks up the topic name in the topic alias table. If found and registered
+    the topic name pointer is cleared so the publish is sent with only the
+    alias, otherwise a free or least recently used alias is assigned to the
+    topic and the publish registers it.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pCtrl       - Pointer to driver control structure.
+    ppTopicName - Pointer to topic name pointer.
+
+  Returns:
+    Topic alias, or zero if the topic cannot be aliased.
+
+  Remarks:
+    Aliases are only used for MQTT V5 connections where the broker has
+    indicated a non-zero topic alias maximum, and are numbered from one up
+    to the lower of the table size and the broker's maximum.
+
+    A newly assigned alias is not registered until mqttTopicAliasRegister
+    is called once the publish has been sent.
+
+*/
+
+static uint16_t mqttTopicAliasResolve
+(
+    WDRV_WINC_CTRLDCPT *pCtrl,
+    const char **ppTopicName
+)
+{
+    WDRV_WINC_MQTT_TOPIC_ALIAS_ENTRY *pVictim = NULL;
+    unsigned int numAliases = WDRV_WINC_MQTT_TOPIC_ALIAS_NUM;
+    size_t topicLen;
+    unsigned int i;
+
+    if ((WDRV_WINC_MQTT_PROTO_VER_5 != pCtrl->mqtt.protocolVer) || (0U == pCtrl->mqtt.connInfo.properties.topicAliasMax))
+    {
+        return 0;
+    }
+
+    topicLen = strlen(*ppTopicName);
+
+    if ((0U == topicLen) || (topicLen > (size_t)WDRV_WINC_MQTT_TOPIC_ALIAS_MAX_TOPIC_LEN))
+    {
+        return 0;
+    }
+
+    if (numAliases > pCtrl->mqtt.connInfo.properties.topicAliasMax)
+    {
+        numAliases = pCtrl->mqtt.connInfo.properties.topicAliasMax;
+    }
+
+    pCtrl->mqtt.topicAliasUseCount++;
+
+    for (i=0; i<numAliases; i++)
+    {
+        WDRV_WINC_MQTT_TOPIC_ALIAS_ENTRY *pEntry = &pCtrl->mqtt.topicAliasTable[i];
+
+        if (0U == pEntry->topicAlias)
+        {
+            /* Prefer an unused entry over evicting one. */
+            if ((NULL == pVictim) || (0U != pVictim->topicAlias))
+            {
+                pVictim = pEntry;
+            }
+
+            continue;
+        }
+
+        if (0 == strcmp(pEntry->topicName, *ppTopicName))
+        {
+            pEntry->lastUsed = pCtrl->mqtt.topicAliasUseCount;
+
+            if (true == pEntry->registered)
+            {
+                /* Alias already registered, publish using the alias alone. */
+                *ppTopicName = NULL;
+            }
+
+            return pEntry->topicAlias;
+        }
+
+        if ((NULL == pVictim) || ((0U != pVictim->topicAlias) && (pEntry->lastUsed < pVictim->lastUsed)))
+        {
+            pVictim = pEntry;
+        }
+    }
+
+    if (NULL == pVictim)
+    {
+        return 0;
+    }
+
+    /* Assign the alias to this topic, the full topic name will be sent. */
+    pVictim->topicAlias = (uint16_t)(pVictim - pCtrl->mqtt.topicAliasTable) + 1U;
+    pVictim->registered = false;
+    pVictim->lastUsed   = pCtrl->mqtt.topicAliasUseCount;
+    (void)memcpy(pVictim->topicName, *ppTopicName, topicLen+1U);
+
+    return pVictim->topicAlias;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void mqttTopicAliasRegister
+    (
+        WDRV_WINC_CTRLDCPT *pCtrl,
+        uint16_t topicAlias
+    )
+
+  Summary:
+    Mark a topic alias as registered with the broker.
+
+  Description:
+    Allows later publishes to the topic to use the alias alone.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pCtrl      - Pointer to driver control structure.
+    topicAlias - Topic alias sent with its topic name.
+
+  Returns:
+    None.
+
+  Remarks:
+    Must only be called once the publish carrying the alias has been sent.
+
+*/
+
+static void mqttTopicAliasRegister
+(
+    WDRV_WINC_CTRLDCPT *pCtrl,
+    uint16_t topicAlias
+)
+{
+    if ((0U == topicAlias) || (topicAlias > WDRV_WINC_MQTT_TOPIC_ALIAS_NUM))
+    {
+        return;
+    }
+
+    if (topicAlias == pCtrl->mqtt.topicAliasTable[topicAlias-1U].topicAlias)
+    {
+        pCtrl->mqtt.topicAliasTable[topicAlias-1U].registered = true;
+    }
+}
+#endif
+
+//*******************************************************************************
+/*
+  Function:
+    static WDRV_WINC_STATUS mqttPubCheck
+    (
+        const WDRV_WINC_DCPT *pDcpt,
         const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo,
         const char *pTopicName,
         const uint8_t *pTopicData,
         size_t topicDataLen,
-        WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
-        uintptr_t pubStatusCbCtx,
-        WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+        unsigned int *pNumCmds,
+        size_t *pDataLen
     )
 
   Summary:
-    Publish a message to an MQTT topic.
+    Check a publish message and size its commands.
 
   Description:
-    Publishes a message to an MQTT topic.
+    Validates the publish parameters and accumulates the number of commands
+    and extra data length required to send the message.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+
+  Parameters:
+    pDcpt        - Pointer to WINC device descriptor.
+    pMsgInfo     - Pointer to message information if required.
+    pTopicName   - Pointer to topic name.
+    pTopicData   - Pointer to data to publish to topic.
+    topicDataLen - Length of data to publish.
+    pNumCmds     - Pointer to running count of commands.
+    pDataLen     - Pointer to running count of extra data length.
+
+  Returns:
+    WDRV_WINC_STATUS_OK          - The message is valid.
+    WDRV_WINC_STATUS_INVALID_ARG - The parameters were incorrect.
 
   Remarks:
-    See wdrv_winc_mqtt.h for usage information.
+    None.
 
 */
 
-WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
+static WDRV_WINC_STATUS mqttPubCheck
 (
-    DRV_HANDLE handle,
+    const WDRV_WINC_DCPT *pDcpt,
     const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo,
     const char *pTopicName,
     const uint8_t *pTopicData,
     size_t topicDataLen,
-    WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
-    uintptr_t pubStatusCbCtx,
-    WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+    unsigned int *pNumCmds,
+    size_t *pDataLen
 )
 {
-    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT *)handle;
-    WINC_CMD_REQ_HANDLE cmdReqHandle;
     size_t topicLen = 0;
 
-    /* Ensure the driver handle and user pointer is valid. */
-    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pTopicData))
+    if (NULL == pTopicData)
     {
         return WDRV_WINC_STATUS_INVALID_ARG;
     }
 
-    /* Ensure the driver instance has been opened. */
-    if (false == pDcpt->isOpen)
-    {
-        return WDRV_WINC_STATUS_NOT_OPEN;
-    }
-
     if (NULL != pTopicName)
     {
         topicLen = strlen(pTopicName);
@@ -1206,7 +1828,8 @@ WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
             return WDRV_WINC_STATUS_INVALID_ARG;
         }
 
-        cmdReqHandle = WDRV_WINC_CmdReqInit(11, topicLen+topicDataLen+(size_t)WDRV_WINC_MQTT_PUB_MAX_CONTENT_TYPE_LEN, mqttCmdRspCallbackHandler, (uintptr_t)pDcpt);
+        *pNumCmds += 11U;
+        *pDataLen += topicLen+topicDataLen+(size_t)WDRV_WINC_MQTT_PUB_MAX_CONTENT_TYPE_LEN;
     }
     else
     {
@@ -1216,82 +1839,369 @@ WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
             return WDRV_WINC_STATUS_INVALID_ARG;
         }
 
-        cmdReqHandle = WDRV_WINC_CmdReqInit(3, topicLen+topicDataLen, mqttCmdRspCallbackHandler, (uintptr_t)pDcpt);
-    }
+        *pNumCmds += 3U;
+        *pDataLen += topicLen+topicDataLen;
 
-    if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
-    {
-        return WDRV_WINC_STATUS_REQUEST_ERROR;
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+        /* Allow for an automatically assigned topic alias property. */
+        *pNumCmds += 2U;
+#endif
     }
 
-    (void)WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_ALL, 0);
+    return WDRV_WINC_STATUS_OK;
+}
 
-    if (NULL == pMsgInfo)
+//*******************************************************************************
+/*
+  Function:
+    static bool mqttPubAddCmds
+    (
+        const WDRV_WINC_DCPT *pDcpt,
+        WINC_CMD_REQ_HANDLE cmdReqHandle,
+        const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo,
+        const char *pTopicName,
+        uint16_t topicAlias,
+        const uint8_t *pTopicData,
+        size_t topicDataLen,
+        uint8_t *pCmdIdx
+    )
+
+  Summary:
+    Add the commands for a publish message to a command request.
+
+  Description:
+    Adds the property and MQTTPUB commands for a single publish message.
+
+  Precondition:
+    mqttPubCheck must have accepted the message.
+
+  Parameters:
+    pDcpt        - Pointer to WINC device descriptor.
+    cmdReqHandle - Command request to add the commands to.
+    pMsgInfo     - Pointer to message information, must not be NULL.
+    pTopicName   - Pointer to topic name, or NULL to publish using the alias.
+    topicAlias   - Topic alias, or zero.
+    pTopicData   - Pointer to data to publish to topic.
+    topicDataLen - Length of data to publish.
+    pCmdIdx      - Pointer to running index of commands within the request.
+
+  Returns:
+    true if the MQTTPUB command was added, otherwise false.
+
+  Remarks:
+    On success the MQTTPUB command index within the request is *pCmdIdx-1,
+    this is used to match responses to the publish table entry.
+
+*/
+
+static bool mqttPubAddCmds
+(
+    const WDRV_WINC_DCPT *pDcpt,
+    WINC_CMD_REQ_HANDLE cmdReqHandle,
+    const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo,
+    const char *pTopicName,
+    uint16_t topicAlias,
+    const uint8_t *pTopicData,
+    size_t topicDataLen,
+    uint8_t *pCmdIdx
+)
+{
+    uint8_t numCmds = 0;
+    bool added;
+
+    if (true == WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_ALL, 0))
     {
-        pMsgInfo = &defaultQoS0MsgInfo;
+        numCmds++;
     }
-    else if (NULL != pMsgInfo->pProperties)
+
+    if (NULL != pMsgInfo->pProperties)
     {
         if (pMsgInfo->pProperties->payloadFormatIndicator > 0U)
         {
-            (void)WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_PAYLOAD_FORMAT_IND, WINC_TYPE_INTEGER_UNSIGNED, pMsgInfo->pProperties->payloadFormatIndicator, 0);
-            (void)WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_PAYLOAD_FORMAT_IND, 1);
+            numCmds += (true == WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_PAYLOAD_FORMAT_IND, WINC_TYPE_INTEGER_UNSIGNED, pMsgInfo->pProperties->payloadFormatIndicator, 0)) ? 1U : 0U;
+            numCmds += (true == WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_PAYLOAD_FORMAT_IND, 1)) ? 1U : 0U;
         }
 
         if (pMsgInfo->pProperties->messageExpiryInterval > 0U)
         {
-            (void)WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_MSG_EXPIRY_INTERVAL, WINC_TYPE_INTEGER_UNSIGNED, pMsgInfo->pProperties->messageExpiryInterval, 0);
-            (void)WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_MSG_EXPIRY_INTERVAL, 1);
-        }
-
-        if ((pMsgInfo->pProperties->topicAlias > 0U) && (NULL != pTopicName))
-        {
-            /* Only include topic alias if the topic name is also being included. */
-            (void)WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_TOPIC_ALIAS, WINC_TYPE_INTEGER_UNSIGNED, pMsgInfo->pProperties->topicAlias, 0);
-            (void)WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_TOPIC_ALIAS, 1);
+            numCmds += (true == WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_MSG_EXPIRY_INTERVAL, WINC_TYPE_INTEGER_UNSIGNED, pMsgInfo->pProperties->messageExpiryInterval, 0)) ? 1U : 0U;
+            numCmds += (true == WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_MSG_EXPIRY_INTERVAL, 1)) ? 1U : 0U;
         }
 
         if (0U != pMsgInfo->pProperties->contentType[0])
         {
-            (void)WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_CONTENT_TYPE, WINC_TYPE_STRING, (uintptr_t)pMsgInfo->pProperties->contentType, strnlen((const char*)pMsgInfo->pProperties->contentType, WDRV_WINC_MQTT_PUB_MAX_CONTENT_TYPE_LEN));
-            (void)WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_CONTENT_TYPE, 1);
+            numCmds += (true == WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_CONTENT_TYPE, WINC_TYPE_STRING, (uintptr_t)pMsgInfo->pProperties->contentType, strnlen((const char*)pMsgInfo->pProperties->contentType, WDRV_WINC_MQTT_PUB_MAX_CONTENT_TYPE_LEN))) ? 1U : 0U;
+            numCmds += (true == WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_CONTENT_TYPE, 1)) ? 1U : 0U;
         }
     }
-    else
+
+    if ((topicAlias > 0U) && (NULL != pTopicName))
     {
-        /* Do nothing. */
+        /* Only include topic alias if the topic name is also being included. */
+        numCmds += (true == WINC_CmdMQTTPROPTX(cmdReqHandle, WINC_CONST_MQTT_PROP_ID_TOPIC_ALIAS, WINC_TYPE_INTEGER_UNSIGNED, topicAlias, 0)) ? 1U : 0U;
+        numCmds += (true == WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_TOPIC_ALIAS, 1)) ? 1U : 0U;
     }
 
     if (WDRV_WINC_MQTT_PROTO_VER_5 == pDcpt->pCtrl->mqtt.protocolVer)
     {
         if (true == pDcpt->pCtrl->mqtt.includeUserProps)
         {
-            (void)WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_USER_PROP, 1);
+            numCmds += (true == WINC_CmdMQTTPROPTXS(cmdReqHandle, (int32_t)WINC_CONST_MQTT_PROP_ID_USER_PROP, 1)) ? 1U : 0U;
         }
     }
 
     if (NULL != pTopicName)
     {
-        (void)WINC_CmdMQTTPUB(cmdReqHandle, (true == pMsgInfo->duplicate) ? 1U : 0U, (uint8_t)pMsgInfo->qos, (true == pMsgInfo->retain) ? 1U : 0U, WINC_TYPE_STRING, (uintptr_t)pTopicName, topicLen, pTopicData, topicDataLen);
+        added = WINC_CmdMQTTPUB(cmdReqHandle, (true == pMsgInfo->duplicate) ? 1U : 0U, (uint8_t)pMsgInfo->qos, (true == pMsgInfo->retain) ? 1U : 0U, WINC_TYPE_STRING, (uintptr_t)pTopicName, strlen(pTopicName), pTopicData, topicDataLen);
     }
     else
     {
-        (void)WINC_CmdMQTTPUB(cmdReqHandle, (true == pMsgInfo->duplicate) ? 1U : 0U, (uint8_t)pMsgInfo->qos, (true == pMsgInfo->retain) ? 1U : 0U, WINC_TYPE_INTEGER_UNSIGNED, pMsgInfo->pProperties->topicAlias, 0, pTopicData, topicDataLen);
+        added = WINC_CmdMQTTPUB(cmdReqHandle, (true == pMsgInfo->duplicate) ? 1U : 0U, (uint8_t)pMsgInfo->qos, (true == pMsgInfo->retain) ? 1U : 0U, WINC_TYPE_INTEGER_UNSIGNED, topicAlias, 0, pTopicData, topicDataLen);
+    }
+
+    if (true == added)
+    {
+        numCmds++;
+    }
+
+    *pCmdIdx += numCmds;
+
+    return added;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
+    (
+        DRV_HANDLE handle,
+        const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo,
+        const char *pTopicName,
+        const uint8_t *pTopicData,
+        size_t topicDataLen,
+        WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
+        uintptr_t pubStatusCbCtx,
+        WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+    )
+
+  Summary:
+    Publish a message to an MQTT topic.
+
+  Description:
+    Publishes a message to an MQTT topic.
+
+  Remarks:
+    See wdrv_winc_mqtt.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_MQTTPublish
+(
+    DRV_HANDLE handle,
+    const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo,
+    const char *pTopicName,
+    const uint8_t *pTopicData,
+    size_t topicDataLen,
+    WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
+    uintptr_t pubStatusCbCtx,
+    WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+)
+{
+    WDRV_WINC_MQTT_PUB_BATCH_ELEM pubElem;
+
+    pubElem.pMsgInfo       = pMsgInfo;
+    pubElem.pTopicName     = pTopicName;
+    pubElem.pTopicData     = pTopicData;
+    pubElem.topicDataLen   = topicDataLen;
+    pubElem.pubStatusCbCtx = pubStatusCbCtx;
+
+    return WDRV_WINC_MQTTPublishBatch(handle, &pubElem, 1, pfPubStatusCb, pPubHandle);
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_MQTTPublishBatch
+    (
+        DRV_HANDLE handle,
+        const WDRV_WINC_MQTT_PUB_BATCH_ELEM *pPubElems,
+        size_t numPubElems,
+        WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
+        WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+    )
+
+  Summary:
+    Publish several messages to MQTT topics.
+
+  Description:
+    Publishes several messages using a single command request.
+
+  Remarks:
+    See wdrv_winc_mqtt.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_MQTTPublishBatch
+(
+    DRV_HANDLE handle,
+    const WDRV_WINC_MQTT_PUB_BATCH_ELEM *pPubElems,
+    size_t numPubElems,
+    WDRV_WINC_MQTT_PUB_STATUS_CALLBACK pfPubStatusCb,
+    WDRV_WINC_MQTT_PUB_HANDLE *pPubHandle
+)
+{
+    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT *)handle;
+    WINC_CMD_REQ_HANDLE cmdReqHandle;
+    WDRV_WINC_MQTT_PUB_ENTRY *pPubEntry[WDRV_WINC_MQTT_PUB_BATCH_NUM];
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+    uint16_t newTopicAliases[WDRV_WINC_MQTT_PUB_BATCH_NUM];
+#endif
+    unsigned int numCmds = 0;
+    size_t dataLen = 0;
+    uint8_t cmdIdx = 0;
+    size_t i;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pPubElems))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    if ((0U == numPubElems) || (numPubElems > WDRV_WINC_MQTT_PUB_BATCH_NUM))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    /* Validate every message and total the size of the command request. */
+    for (i=0; i<numPubElems; i++)
+    {
+        WDRV_WINC_STATUS status;
+
+        status = mqttPubCheck(pDcpt, pPubElems[i].pMsgInfo, pPubElems[i].pTopicName, pPubElems[i].pTopicData, pPubElems[i].topicDataLen, &numCmds, &dataLen);
+
+        if (WDRV_WINC_STATUS_OK != status)
+        {
+            return status;
+        }
+    }
+
+    /* Reserve a publish table entry for each message which will report a
+     status, QoS 0 messages without a callback are not tracked. */
+    for (i=0; i<numPubElems; i++)
+    {
+        pPubEntry[i] = NULL;
+
+        if ((NULL == pfPubStatusCb) && ((NULL == pPubElems[i].pMsgInfo) || (WDRV_WINC_MQTT_QOS_0 == pPubElems[i].pMsgInfo->qos)))
+        {
+            continue;
+        }
+
+        pPubEntry[i] = mqttPubFindFree(pDcpt->pCtrl);
+
+        if (NULL == pPubEntry[i])
+        {
+            mqttPubBatchRelease(pPubEntry, i);
+
+            return WDRV_WINC_STATUS_BUSY;
+        }
+
+        pPubEntry[i]->inUse = true;
+    }
+
+    cmdReqHandle = WDRV_WINC_CmdReqInit(numCmds, dataLen, mqttCmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+    if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
+    {
+        mqttPubBatchRelease(pPubEntry, numPubElems);
+
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    /* Build all messages into the one command request and claim the publish
+     table entries before the request can complete. */
+    for (i=0; i<numPubElems; i++)
+    {
+        const WDRV_WINC_MQTT_MSG_INFO *pMsgInfo = pPubElems[i].pMsgInfo;
+        const char *pTopicName = pPubElems[i].pTopicName;
+        uint16_t topicAlias = 0;
+        uint16_t newTopicAlias = 0;
+
+        if (NULL == pMsgInfo)
+        {
+            pMsgInfo = &defaultQoS0MsgInfo;
+        }
+
+        if (NULL != pMsgInfo->pProperties)
+        {
+            topicAlias = pMsgInfo->pProperties->topicAlias;
+        }
+
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+        if ((0U == topicAlias) && (NULL != pTopicName))
+        {
+            topicAlias = mqttTopicAliasResolve(pDcpt->pCtrl, &pTopicName);
+
+            if (NULL != pTopicName)
+            {
+                /* This publish registers the alias with the broker. */
+                newTopicAlias = topicAlias;
+            }
+        }
+
+        newTopicAliases[i] = newTopicAlias;
+#endif
+
+        if (false == mqttPubAddCmds(pDcpt, cmdReqHandle, pMsgInfo, pTopicName, topicAlias, pPubElems[i].pTopicData, pPubElems[i].topicDataLen, &cmdIdx))
+        {
+            /* Nothing has been sent, discard the whole batch. */
+            WDRV_WINC_DevDiscardCmdReq(cmdReqHandle);
+
+            mqttPubBatchRelease(pPubEntry, numPubElems);
+
+            return WDRV_WINC_STATUS_REQUEST_ERROR;
+        }
+
+        if (NULL == pPubEntry[i])
+        {
+            continue;
+        }
+
+        pPubEntry[i]->packetIdValid  = false;
+        pPubEntry[i]->qos            = pMsgInfo->qos;
+        pPubEntry[i]->cmdIdx         = cmdIdx - 1U;
+        pPubEntry[i]->topicAlias     = newTopicAlias;
+        pPubEntry[i]->packetId       = 0;
+        pPubEntry[i]->pubHandle      = (WDRV_WINC_MQTT_PUB_HANDLE)cmdReqHandle;
+        pPubEntry[i]->pfPubStatusCb  = pfPubStatusCb;
+        pPubEntry[i]->pubStatusCbCtx = pPubElems[i].pubStatusCbCtx;
     }
 
     if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
     {
+        mqttPubBatchRelease(pPubEntry, numPubElems);
+
         return WDRV_WINC_STATUS_REQUEST_ERROR;
     }
 
+#if WDRV_WINC_MQTT_TOPIC_ALIAS_NUM > 0
+    /* The batch has been queued, aliases it carries may now be used alone. */
+    for (i=0; i<numPubElems; i++)
+    {
+        mqttTopicAliasRegister(pDcpt->pCtrl, newTopicAliases[i]);
+    }
+#endif
+
     if (NULL != pPubHandle)
     {
         *pPubHandle = (uintptr_t)cmdReqHandle;
     }
 
-    pDcpt->pCtrl->mqtt.pfPubStatusCb  = pfPubStatusCb;
-    pDcpt->pCtrl->mqtt.pubStatusCbCtx = pubStatusCbCtx;
-
     return WDRV_WINC_STATUS_OK;
 }
 
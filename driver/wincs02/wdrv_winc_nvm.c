@@ -287,6 +287,162 @@ static WDRV_WINC_STATUS nvmReadBuffer
     return WDRV_WINC_STATUS_OK;
 }
 
+//*******************************************************************************
+/*
+  Function:
+    static WDRV_WINC_STATUS nvmProgramFill(WDRV_WINC_DCPT *pDcpt)
+
+  Summary:
+    Issue NVM program write commands.
+
+  Description:
+    Sends write commands for the current sector until the number outstanding
+      reaches WDRV_WINC_NVM_PROGRAM_WINDOW.
+
+  Precondition:
+    WDRV_WINC_NVMProgram must have been called.
+    The current sector must have been erased.
+
+  Parameters:
+    pDcpt - Pointer to WINC device descriptor.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The request has been accepted.
+    WDRV_WINC_STATUS_REQUEST_ERROR - The request to the WINC was rejected.
+
+  Remarks:
+    All write commands are placed within a single command request.
+
+*/
+
+static WDRV_WINC_STATUS nvmProgramFill(WDRV_WINC_DCPT *pDcpt)
+{
+    WDRV_WINC_NVM_OPERATION_STATE *pState = &pDcpt->pCtrl->nvmState;
+    WINC_CMD_REQ_HANDLE cmdReqHandle;
+    uint32_t offset = pState->offset;
+    uint32_t length = pState->length;
+    uint32_t reqLength = 0;
+    uint8_t numCmds = 0;
+
+    /* Determine how many writes are needed to fill the window within this sector. */
+    while (((pState->program.numPending+numCmds) < WDRV_WINC_NVM_PROGRAM_WINDOW) && (offset < pState->program.sectorEnd) && (length > 0U))
+    {
+        uint32_t chunkLength = pState->program.sectorEnd - offset;
+
+        if (chunkLength > length)
+        {
+            chunkLength = length;
+        }
+
+        if (chunkLength > WINC_CMD_PARAM_MAX_NVM_LENGTH)
+        {
+            chunkLength = WINC_CMD_PARAM_MAX_NVM_LENGTH;
+        }
+
+        offset    += chunkLength;
+        length    -= chunkLength;
+        reqLength += chunkLength;
+        numCmds++;
+    }
+
+    if (0U == numCmds)
+    {
+        return WDRV_WINC_STATUS_OK;
+    }
+
+    cmdReqHandle = WDRV_WINC_CmdReqInit(numCmds, reqLength, nvmCmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+    if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    while (offset != pState->offset)
+    {
+        uint32_t chunkLength = offset - pState->offset;
+
+        if (chunkLength > WINC_CMD_PARAM_MAX_NVM_LENGTH)
+        {
+            chunkLength = WINC_CMD_PARAM_MAX_NVM_LENGTH;
+        }
+
+        (void)WINC_CmdNVMWR(cmdReqHandle, pState->offset, (uint16_t)chunkLength, pState->program.pData, chunkLength);
+
+        pState->offset        += chunkLength;
+        pState->length        -= chunkLength;
+        pState->program.pData += chunkLength;
+    }
+
+    if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    pState->program.numPending += numCmds;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static WDRV_WINC_STATUS nvmProgramNext(WDRV_WINC_DCPT *pDcpt)
+
+  Summary:
+    Advance an NVM program operation.
+
+  Description:
+    Erases the next sector to be written or, once all data has been written,
+      starts the check of the programmed region.
+
+  Precondition:
+    WDRV_WINC_NVMProgram must have been called.
+    No write commands may be outstanding.
+
+  Parameters:
+    pDcpt - Pointer to WINC device descriptor.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The request has been accepted.
+    WDRV_WINC_STATUS_REQUEST_ERROR - The request to the WINC was rejected.
+
+  Remarks:
+    None.
+
+*/
+
+static WDRV_WINC_STATUS nvmProgramNext(WDRV_WINC_DCPT *pDcpt)
+{
+    WDRV_WINC_NVM_OPERATION_STATE *pState = &pDcpt->pCtrl->nvmState;
+    WINC_CMD_REQ_HANDLE cmdReqHandle;
+
+    cmdReqHandle = WDRV_WINC_CmdReqInit(2, 0, nvmCmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+    if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    if (0U == pState->length)
+    {
+        (void)WINC_CmdNVMC(cmdReqHandle, WINC_CFG_PARAM_ID_NVM_CHECK_MODE, WINC_TYPE_INTEGER_UNSIGNED, (uintptr_t)pState->program.mode, 0);
+        (void)WINC_CmdNVMCHK(cmdReqHandle, pState->program.startOffset, pState->program.totalLength);
+    }
+    else
+    {
+        pState->program.sectorEnd = pState->offset + pState->geom.sector.size;
+
+        (void)WINC_CmdNVMER(cmdReqHandle, (uint8_t)(pState->offset / pState->geom.sector.size), 1);
+    }
+
+    if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    return WDRV_WINC_STATUS_OK;
+}
+
 //*******************************************************************************
 /*
   Function:
@@ -523,7 +679,31 @@ static void nvmCmdRspCallbackHandler
                         {
                             nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_ERROR, 0);
                         }
-                        else
+                        else if (WDRV_WINC_NVM_OPERATION_PROGRAM == pDcpt->pCtrl->nvmState.operation)
+                        {
+                            WDRV_WINC_STATUS status = WDRV_WINC_STATUS_OK;
+
+                            pDcpt->pCtrl->nvmState.program.numPending--;
+
+                            if ((pDcpt->pCtrl->nvmState.length > 0U) && (pDcpt->pCtrl->nvmState.offset < pDcpt->pCtrl->nvmState.program.sectorEnd))
+                            {
+                                status = nvmProgramFill(pDcpt);
+                            }
+                            else if (0U == pDcpt->pCtrl->nvmState.program.numPending)
+                            {
+                                status = nvmProgramNext(pDcpt);
+                            }
+                            else
+                            {
+                                /* Wait for remaining writes to this sector. */
+                            }
+
+                            if (WDRV_WINC_STATUS_OK != status)
+                            {
+                                nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_ERROR, 0);
+                            }
+                        }
+                        else if (WDRV_WINC_NVM_OPERATION_WRITE == pDcpt->pCtrl->nvmState.operation)
                         {
                             WINC_DEV_PARAM_ELEM elems[10];
                             uint32_t length;
@@ -703,7 +883,18 @@ void WDRV_WINC_NVMProcessAEC
     {
         case WINC_AEC_ID_NVMER:
         {
-            nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_SUCCESS, 0);
+            if (WDRV_WINC_NVM_OPERATION_PROGRAM == pDcpt->pCtrl->nvmState.operation)
+            {
+                if (WDRV_WINC_STATUS_OK != nvmProgramFill(pDcpt))
+                {
+                    nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_ERROR, 0);
+                }
+            }
+            else
+            {
+                nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_SUCCESS, 0);
+            }
+
             break;
         }
 
@@ -730,7 +921,19 @@ void WDRV_WINC_NVMProcessAEC
                 opStatusInfo.hash.p = pElems->elems[3].pData;
             }
 
-            nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_SUCCESS, (uintptr_t)&opStatusInfo);
+            if (WDRV_WINC_NVM_OPERATION_PROGRAM == pDcpt->pCtrl->nvmState.operation)
+            {
+                WDRV_WINC_NVM_PROGRAM_STATUS_INFO programStatusInfo;
+
+                programStatusInfo.check     = opStatusInfo;
+                programStatusInfo.elapsedMs = (uint32_t)(((SYS_TIME_Counter64Get() - pDcpt->pCtrl->nvmState.program.startTime) * 1000U) / SYS_TIME_FrequencyGet());
+
+                nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_SUCCESS, (uintptr_t)&programStatusInfo);
+            }
+            else
+            {
+                nvmReportStatus(pDcpt, WDRV_WINC_NVM_STATUS_SUCCESS, (uintptr_t)&opStatusInfo);
+            }
             break;
         }
 
@@ -1033,4 +1236,88 @@ WDRV_WINC_STATUS WDRV_WINC_NVMCheck
     return WDRV_WINC_STATUS_OK;
 }
 
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_NVMProgram
+    (
+        DRV_HANDLE handle,
+        const void *pBuffer,
+        uint32_t offset,
+        uint32_t length,
+        WDRV_WINC_NVM_CHECK_MODE_TYPE mode,
+        WDRV_WINC_NVM_STATUS_CALLBACK pfUpdateStatusCB
+    )
+
+  Summary:
+    Programs data into the NVM.
+
+  Description:
+    Erases, writes and checks a region of the NVM in a single operation.
+
+  Remarks:
+    See wdrv_winc_nvm.h for usage information.
+
+*/
+WDRV_WINC_STATUS WDRV_WINC_NVMProgram
+(
+    DRV_HANDLE handle,
+    const void *pBuffer,
+    uint32_t offset,
+    uint32_t length,
+    WDRV_WINC_NVM_CHECK_MODE_TYPE mode,
+    WDRV_WINC_NVM_STATUS_CALLBACK pfUpdateStatusCB
+)
+{
+    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT*)handle;
+    WDRV_WINC_NVM_OPERATION_STATE *pState;
+    WDRV_WINC_STATUS status;
+
+    /* Ensure the driver is open and no NVM operation is in progress. */
+    status = nvmInProgress(pDcpt);
+
+    if (WDRV_WINC_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    pState = &pDcpt->pCtrl->nvmState;
+
+    /* Ensure the user pointer and length are valid. */
+    if ((NULL == pBuffer) || (0U == length) || (0U == pState->geom.sector.size))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the region starts on a sector boundary and lies within the partition. */
+    if ((0U != (offset % pState->geom.sector.size)) || ((offset+length) > WINC_CMD_PARAM_MAX_NVM_OFFSET) ||
+            ((offset+length) > ((uint32_t)pState->geom.sector.number * pState->geom.sector.size)))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    pState->offset                  = offset;
+    pState->length                  = length;
+    pState->program.pData           = pBuffer;
+    pState->program.startOffset     = offset;
+    pState->program.totalLength     = length;
+    pState->program.numPending      = 0;
+    pState->program.mode            = mode;
+    pState->program.startTime       = SYS_TIME_Counter64Get();
+
+    status = nvmProgramNext(pDcpt);
+
+    if (WDRV_WINC_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    /* Set in progress flag and callback. */
+    pState->operation           = WDRV_WINC_NVM_OPERATION_PROGRAM;
+    pState->pfOperationStatusCB = pfUpdateStatusCB;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
 #endif /* WDRV_WINC_MOD_DISABLE_NVM */
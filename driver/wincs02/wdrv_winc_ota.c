@@ -1068,4 +1068,384 @@ WDRV_WINC_STATUS WDRV_WINC_OTAOptionsSet
     return WDRV_WINC_STATUS_OK;
 }
 
+#ifndef WDRV_WINC_MOD_DISABLE_NVM
+//*******************************************************************************
+/*
+  Function:
+    static void otaResumeChunkDone
+    (
+        WDRV_WINC_DCPT *const pDcpt,
+        WDRV_WINC_OTA_UPDATE_STATUS status
+    )
+
+  Summary:
+    Completes a resumable OTA chunk.
+
+  Description:
+    Advances the state block if the chunk was written and reports progress
+      to the application.
+
+  Precondition:
+    WDRV_WINC_OTAResumableWrite must have been called.
+
+  Parameters:
+    pDcpt  - Pointer to WINC device descriptor.
+    status - Status of the chunk write.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+
+*/
+
+static void otaResumeChunkDone
+(
+    WDRV_WINC_DCPT *const pDcpt,
+    WDRV_WINC_OTA_UPDATE_STATUS status
+)
+{
+    WDRV_WINC_OTA_OPERATION_STATE *const pOTAState = &pDcpt->pCtrl->otaState;
+    WDRV_WINC_OTA_RESUME_STATE *const pState = pOTAState->pResumeState;
+    WDRV_WINC_OTA_PROGRESS_CALLBACK pfProgressCB = pOTAState->pfProgressCB;
+    WDRV_WINC_OTA_PROGRESS_INFO info;
+
+    info.offset      = pState->offset;
+    info.length      = pOTAState->chunkLength;
+    info.elapsedMs   = (uint32_t)(((SYS_TIME_Counter64Get() - pOTAState->chunkStartTime) * 1000U) / SYS_TIME_FrequencyGet());
+    info.bytesPerSec = 0;
+
+    if (info.elapsedMs > 0U)
+    {
+        info.bytesPerSec = (uint32_t)(((uint64_t)info.length * 1000U) / info.elapsedMs);
+    }
+
+    pOTAState->pChunk      = NULL;
+    pOTAState->chunkLength = 0;
+
+    if (WDRV_WINC_OTA_STATUS_FAIL != status)
+    {
+        pState->offset += info.length;
+
+        if (pState->offset == pState->imageLength)
+        {
+            status = WDRV_WINC_OTA_STATUS_COMPLETE;
+
+            pOTAState->operation    = WDRV_WINC_OTA_OPERATION_NONE;
+            pOTAState->pResumeState = NULL;
+            pOTAState->pfProgressCB = NULL;
+        }
+    }
+
+    if (NULL != pfProgressCB)
+    {
+        pfProgressCB((DRV_HANDLE)pDcpt, pState, &info, status);
+    }
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void otaResumeNVMCallback
+    (
+        DRV_HANDLE handle,
+        WDRV_WINC_NVM_OPERATION_TYPE operation,
+        WDRV_WINC_NVM_STATUS_TYPE status,
+        uintptr_t opStatusInfo
+    )
+
+  Summary:
+    NVM status callback for resumable OTA chunks.
+
+  Description:
+    Follows a sector erase with the chunk write and completes the chunk once
+      the write has finished.
+
+  Precondition:
+    WDRV_WINC_OTAResumableWrite must have been called.
+
+  Parameters:
+    handle       - Client handle obtained by a call to WDRV_WINC_Open.
+    operation    - NVM operation.
+    status       - Status of NVM operation.
+    opStatusInfo - Operation status information.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+
+*/
+
+static void otaResumeNVMCallback
+(
+    DRV_HANDLE handle,
+    WDRV_WINC_NVM_OPERATION_TYPE operation,
+    WDRV_WINC_NVM_STATUS_TYPE status,
+    uintptr_t opStatusInfo
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+    WDRV_WINC_OTA_OPERATION_STATE *pOTAState;
+
+    (void)opStatusInfo;
+
+    if ((NULL == pDcpt) || (NULL == pDcpt->pCtrl))
+    {
+        return;
+    }
+
+    pOTAState = &pDcpt->pCtrl->otaState;
+
+    if ((WDRV_WINC_OTA_OPERATION_RESUMABLE_WRITE != pOTAState->operation) || (0U == pOTAState->chunkLength))
+    {
+        return;
+    }
+
+    if (WDRV_WINC_NVM_STATUS_SUCCESS != status)
+    {
+        otaResumeChunkDone(pDcpt, WDRV_WINC_OTA_STATUS_FAIL);
+    }
+    else if (WDRV_WINC_NVM_OPERATION_ERASE == operation)
+    {
+        if (WDRV_WINC_STATUS_OK != WDRV_WINC_NVMWrite(handle, (void*)pOTAState->pChunk, pOTAState->pResumeState->offset, pOTAState->chunkLength, otaResumeNVMCallback))
+        {
+            otaResumeChunkDone(pDcpt, WDRV_WINC_OTA_STATUS_FAIL);
+        }
+    }
+    else
+    {
+        otaResumeChunkDone(pDcpt, WDRV_WINC_OTA_STATUS_PROGRESS);
+    }
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_OTAResumableStart
+    (
+        DRV_HANDLE handle,
+        WDRV_WINC_OTA_RESUME_STATE *const pState,
+        uint32_t imageLength,
+        const uint8_t *const pImageId,
+        size_t imageIdLength,
+        const WDRV_WINC_OTA_PROGRESS_CALLBACK pfProgressCB
+    )
+
+  Summary:
+    Starts or resumes a host supplied OTA image write.
+
+  Description:
+    Begins writing an OTA image supplied by the application in chunks to the
+      NVM, resuming from the state block offset if it matches the image length
+      and identity.
+
+  Remarks:
+    See wdrv_winc_ota.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_OTAResumableStart
+(
+    DRV_HANDLE handle,
+    WDRV_WINC_OTA_RESUME_STATE *const pState,
+    uint32_t imageLength,
+    const uint8_t *const pImageId,
+    size_t imageIdLength,
+    const WDRV_WINC_OTA_PROGRESS_CALLBACK pfProgressCB
+)
+{
+    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT*)handle;
+    const WDRV_WINC_NVM_GEOM_INFO *pGeom;
+    WDRV_WINC_STATUS status;
+
+    /* Ensure the driver is open and no OTA operation is in progress. */
+    status = otaInProgress(pDcpt);
+
+    if (WDRV_WINC_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    if ((NULL == pState) || (0U == imageLength) || (NULL == pImageId) || (0U == imageIdLength) || (imageIdLength > WDRV_WINC_OTA_RESUME_ID_MAX_LEN))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    pGeom = WDRV_WINC_NVMGeometryGet(handle);
+
+    /* Ensure the image will fit in the NVM partition. */
+    if ((NULL == pGeom) || (imageLength > ((uint32_t)pGeom->sector.number * pGeom->sector.size)))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Restart from the beginning unless the state block is for this image. */
+    if ((WDRV_WINC_OTA_RESUME_MAGIC != pState->magic) || (imageLength != pState->imageLength) || (pState->offset > imageLength)
+            || (imageIdLength != pState->imageIdLength) || (0 != memcmp(pState->imageId, pImageId, imageIdLength)))
+    {
+        (void)memset(pState, 0, sizeof(WDRV_WINC_OTA_RESUME_STATE));
+
+        pState->magic         = WDRV_WINC_OTA_RESUME_MAGIC;
+        pState->imageLength   = imageLength;
+        pState->offset        = 0;
+        pState->imageIdLength = (uint8_t)imageIdLength;
+        (void)memcpy(pState->imageId, pImageId, imageIdLength);
+    }
+
+    pDcpt->pCtrl->otaState.operation    = WDRV_WINC_OTA_OPERATION_RESUMABLE_WRITE;
+    pDcpt->pCtrl->otaState.opId         = 0;
+    pDcpt->pCtrl->otaState.pResumeState = pState;
+    pDcpt->pCtrl->otaState.pfProgressCB = pfProgressCB;
+    pDcpt->pCtrl->otaState.pChunk       = NULL;
+    pDcpt->pCtrl->otaState.chunkLength  = 0;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_OTAResumableWrite
+    (
+        DRV_HANDLE handle,
+        const void *const pData,
+        uint32_t length
+    )
+
+  Summary:
+    Writes the next chunk of a resumable OTA image.
+
+  Description:
+    Erases any sectors started by the chunk and writes it to the NVM at the
+      current state block offset.
+
+  Remarks:
+    See wdrv_winc_ota.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_OTAResumableWrite
+(
+    DRV_HANDLE handle,
+    const void *const pData,
+    uint32_t length
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+    WDRV_WINC_OTA_OPERATION_STATE *pOTAState;
+    const WDRV_WINC_NVM_GEOM_INFO *pGeom;
+    uint32_t offset;
+    uint32_t firstSector;
+    uint32_t lastSector;
+    WDRV_WINC_STATUS status;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pData) || (0U == length))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    pOTAState = &pDcpt->pCtrl->otaState;
+
+    /* Ensure a resumable write is active and idle. */
+    if ((WDRV_WINC_OTA_OPERATION_RESUMABLE_WRITE != pOTAState->operation) || (0U != pOTAState->chunkLength))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    offset = pOTAState->pResumeState->offset;
+
+    if (length > (pOTAState->pResumeState->imageLength - offset))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    pGeom = WDRV_WINC_NVMGeometryGet(handle);
+
+    if ((NULL == pGeom) || (0U == pGeom->sector.size))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    pOTAState->pChunk         = (const uint8_t*)pData;
+    pOTAState->chunkLength    = length;
+    pOTAState->chunkStartTime = SYS_TIME_Counter64Get();
+
+    /* Sectors starting within the chunk have not been written yet, the sector
+     holding the offset was erased when the image first reached it. */
+    firstSector = (offset + pGeom->sector.size - 1U) / pGeom->sector.size;
+    lastSector  = (offset + length - 1U) / pGeom->sector.size;
+
+    if (firstSector <= lastSector)
+    {
+        status = WDRV_WINC_NVMEraseSector(handle, (uint8_t)firstSector, (uint8_t)(lastSector - firstSector + 1U), otaResumeNVMCallback);
+    }
+    else
+    {
+        status = WDRV_WINC_NVMWrite(handle, (void*)pOTAState->pChunk, offset, length, otaResumeNVMCallback);
+    }
+
+    if (WDRV_WINC_STATUS_OK != status)
+    {
+        pOTAState->pChunk      = NULL;
+        pOTAState->chunkLength = 0;
+    }
+
+    return status;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_OTAResumableStop(DRV_HANDLE handle)
+
+  Summary:
+    Stops a resumable OTA image write.
+
+  Description:
+    Ends the resumable write leaving the state block unchanged.
+
+  Remarks:
+    See wdrv_winc_ota.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_OTAResumableStop(DRV_HANDLE handle)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+
+    /* Ensure the driver handle is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    if ((WDRV_WINC_OTA_OPERATION_RESUMABLE_WRITE != pDcpt->pCtrl->otaState.operation) || (0U != pDcpt->pCtrl->otaState.chunkLength))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    pDcpt->pCtrl->otaState.operation    = WDRV_WINC_OTA_OPERATION_NONE;
+    pDcpt->pCtrl->otaState.pResumeState = NULL;
+    pDcpt->pCtrl->otaState.pfProgressCB = NULL;
+
+    return WDRV_WINC_STATUS_OK;
+}
+#endif /* WDRV_WINC_MOD_DISABLE_NVM */
+
 #endif /* WDRV_WINC_MOD_DISABLE_OTA */
@@ -179,6 +179,303 @@ static void pingCmdRspCallbackHandler
     }
 }
 
+#ifndef WDRV_WINC_MOD_DISABLE_ICMP
+//*******************************************************************************
+/*
+  Function:
+    static void pingSessionCmdRspCallbackHandler
+    (
+        uintptr_t context,
+        WINC_DEVICE_HANDLE devHandle,
+        WINC_CMD_REQ_HANDLE cmdReqHandle,
+        WINC_DEV_CMDREQ_EVENT_TYPE event,
+        uintptr_t eventArg
+    )
+
+  Summary:
+    Ping session command response callback handler.
+
+  Description:
+    Receives command responses for echo requests sent by the ping session.
+
+  Precondition:
+    WDRV_WINC_DevTransmitCmdReq must have been called to submit command request.
+
+  Parameters:
+    context      - Context provided to WDRV_WINC_CmdReqInit for callback.
+    devHandle    - WINC device handle.
+    cmdReqHandle - Command request handle.
+    event        - Command request event being raised.
+    eventArg     - Optional event specific information.
+
+  Returns:
+    None.
+
+  Remarks:
+    Echo requests rejected by the WINC are withdrawn without being recorded.
+
+*/
+
+static void pingSessionCmdRspCallbackHandler
+(
+    uintptr_t context,
+    WINC_DEVICE_HANDLE devHandle,
+    WINC_CMD_REQ_HANDLE cmdReqHandle,
+    WINC_DEV_CMDREQ_EVENT_TYPE event,
+    uintptr_t eventArg
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)context;
+    WDRV_WINC_PING_SESSION *pSession;
+    uint8_t i;
+
+    if ((NULL == pDcpt) || (NULL == pDcpt->pCtrl))
+    {
+        return;
+    }
+
+    pSession = &pDcpt->pCtrl->pingSession;
+
+    switch (event)
+    {
+        case WINC_DEV_CMDREQ_EVENT_STATUS_COMPLETE:
+        {
+            /* Release the command request from any target still bound to it. */
+            for (i=0; i<WDRV_WINC_PING_TARGET_NUM; i++)
+            {
+                if (cmdReqHandle == pSession->targets[i].cmdReqHandle)
+                {
+                    pSession->targets[i].cmdReqHandle = WINC_CMD_REQ_INVALID_HANDLE;
+                }
+            }
+
+            OSAL_Free((WINC_COMMAND_REQUEST*)cmdReqHandle);
+            break;
+        }
+
+        case WINC_DEV_CMDREQ_EVENT_CMD_STATUS:
+        {
+            const WINC_DEV_EVENT_STATUS_ARGS *pStatusInfo = (const WINC_DEV_EVENT_STATUS_ARGS*)eventArg;
+
+            if ((NULL == pStatusInfo) || (WINC_STATUS_OK == pStatusInfo->status))
+            {
+                break;
+            }
+
+            /* The echo request was not sent, withdraw it without recording a loss. */
+            for (i=0; i<WDRV_WINC_PING_TARGET_NUM; i++)
+            {
+                WDRV_WINC_PING_TARGET *pTarget = &pSession->targets[i];
+
+                if (cmdReqHandle != pTarget->cmdReqHandle)
+                {
+                    continue;
+                }
+
+                pTarget->cmdReqHandle = WINC_CMD_REQ_INVALID_HANDLE;
+
+                if (true == pTarget->outstanding)
+                {
+                    pTarget->outstanding = false;
+
+                    if (pTarget->sent > 0U)
+                    {
+                        pTarget->sent--;
+                    }
+                }
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static uint64_t pingSessionElapsedMS(uint64_t count)
+
+  Summary:
+    Convert a system time counter difference to milliseconds.
+
+  Description:
+    Converts a 64-bit system time counter difference to milliseconds, rounding
+      up.
+
+  Precondition:
+    None.
+
+  Parameters:
+    count - Counter difference.
+
+  Returns:
+    Number of milliseconds.
+
+  Remarks:
+    Rounding up ensures a reply's round trip time never exceeds the elapsed
+      time of the request it answers.
+
+*/
+
+static uint64_t pingSessionElapsedMS(uint64_t count)
+{
+    uint32_t freq = SYS_TIME_FrequencyGet();
+
+    return ((count * 1000U) + freq - 1U) / freq;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void pingSessionRecord
+    (
+        WDRV_WINC_DCPT *pDcpt,
+        uint8_t targetIdx,
+        uint16_t rtt
+    )
+
+  Summary:
+    Record a ping session result.
+
+  Description:
+    Completes the outstanding echo request of a target and records the round
+      trip time in its history.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pDcpt     - Pointer to WINC device descriptor.
+    targetIdx - Index of the target.
+    rtt       - Round trip time, or WDRV_WINC_PING_RTT_LOST.
+
+  Returns:
+    None.
+
+  Remarks:
+    None.
+
+*/
+
+static void pingSessionRecord
+(
+    WDRV_WINC_DCPT *pDcpt,
+    uint8_t targetIdx,
+    uint16_t rtt
+)
+{
+    WDRV_WINC_PING_TARGET *pTarget = &pDcpt->pCtrl->pingSession.targets[targetIdx];
+
+    pTarget->outstanding  = false;
+    pTarget->cmdReqHandle = WINC_CMD_REQ_INVALID_HANDLE;
+
+    pTarget->history[pTarget->historyHead] = rtt;
+    pTarget->historyHead = (uint8_t)((pTarget->historyHead + 1U) % WDRV_WINC_PING_HISTORY_NUM);
+
+    if (pTarget->historyCount < WDRV_WINC_PING_HISTORY_NUM)
+    {
+        pTarget->historyCount++;
+    }
+
+    if (WDRV_WINC_PING_RTT_LOST != rtt)
+    {
+        pTarget->received++;
+    }
+
+    if (NULL != pDcpt->pCtrl->pingSession.pfResultCB)
+    {
+        pDcpt->pCtrl->pingSession.pfResultCB((DRV_HANDLE)pDcpt, targetIdx, pTarget->seqNum, rtt);
+    }
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static bool pingSessionReply
+    (
+        WDRV_WINC_DCPT *pDcpt,
+        const WDRV_WINC_IP_MULTI_ADDRESS *const pIPAddr,
+        WDRV_WINC_IP_ADDRESS_TYPE ipAddrType,
+        uint16_t rtt
+    )
+
+  Summary:
+    Match an echo reply to a ping session target.
+
+  Description:
+    Records the reply against the target with the same address which has an
+      echo request outstanding. A reply with a round trip time longer than
+      the time since that request was sent is a late reply to an earlier
+      request and is discarded.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pDcpt      - Pointer to WINC device descriptor.
+    pIPAddr    - Pointer to IP address responding.
+    ipAddrType - Type of IP address.
+    rtt        - Round trip time.
+
+  Returns:
+    true if the reply matched a ping session target or was discarded as late,
+      false otherwise.
+
+  Remarks:
+    None.
+
+*/
+
+static bool pingSessionReply
+(
+    WDRV_WINC_DCPT *pDcpt,
+    const WDRV_WINC_IP_MULTI_ADDRESS *const pIPAddr,
+    WDRV_WINC_IP_ADDRESS_TYPE ipAddrType,
+    uint16_t rtt
+)
+{
+    WDRV_WINC_PING_SESSION *pSession = &pDcpt->pCtrl->pingSession;
+    uint64_t now;
+    size_t addrLen;
+    uint8_t i;
+
+    if (false == pSession->active)
+    {
+        return false;
+    }
+
+    now = SYS_TIME_Counter64Get();
+
+    addrLen = (WDRV_WINC_IP_ADDRESS_TYPE_IPV4 == ipAddrType) ? sizeof(WDRV_WINC_IPV4_ADDR) : sizeof(WDRV_WINC_IPV6_ADDR);
+
+    for (i=0; i<WDRV_WINC_PING_TARGET_NUM; i++)
+    {
+        const WDRV_WINC_PING_TARGET *pTarget = &pSession->targets[i];
+
+        if ((false == pTarget->inUse) || (false == pTarget->outstanding) || (ipAddrType != pTarget->ipAddrType))
+        {
+            continue;
+        }
+
+        if (0 == memcmp(pIPAddr, &pTarget->ipAddr, addrLen))
+        {
+            if ((uint64_t)rtt <= pingSessionElapsedMS(now - pTarget->sendTime))
+            {
+                pingSessionRecord(pDcpt, i, rtt);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
 //*******************************************************************************
 /*
   Function:
@@ -224,6 +521,36 @@ void WDRV_WINC_ICMPProcessAEC
                 break;
             }
 
+#ifndef WDRV_WINC_MOD_DISABLE_ICMP
+            if (true == pDcpt->pCtrl->pingSession.active)
+            {
+                WDRV_WINC_IP_MULTI_ADDRESS ipAddr;
+                bool matched = false;
+
+                (void)WINC_CmdReadParamElem(&pElems->elems[1], WINC_TYPE_INTEGER, &rtt, sizeof(rtt));
+
+                if ((WINC_TYPE_IPV4ADDR == pElems->elems[0].type) && (pElems->elems[0].length <= sizeof(WDRV_WINC_IPV4_ADDR)))
+                {
+                    (void)memcpy(&ipAddr.v4.v, pElems->elems[0].pData, sizeof(WDRV_WINC_IPV4_ADDR));
+                    matched = pingSessionReply(pDcpt, &ipAddr, WDRV_WINC_IP_ADDRESS_TYPE_IPV4, rtt);
+                }
+                else if ((WINC_TYPE_IPV6ADDR == pElems->elems[0].type) && (pElems->elems[0].length <= sizeof(WDRV_WINC_IPV6_ADDR)))
+                {
+                    (void)memcpy(&ipAddr.v6.v, pElems->elems[0].pData, sizeof(WDRV_WINC_IPV6_ADDR));
+                    matched = pingSessionReply(pDcpt, &ipAddr, WDRV_WINC_IP_ADDRESS_TYPE_IPV6, rtt);
+                }
+                else
+                {
+                    /* Address not recognised. */
+                }
+
+                if (true == matched)
+                {
+                    break;
+                }
+            }
+#endif
+
             if (NULL != pDcpt->pCtrl->pfICMPEchoResponseCB)
             {
                 WDRV_WINC_IP_MULTI_ADDRESS ipAddr;
@@ -403,3 +730,437 @@ WDRV_WINC_STATUS WDRV_WINC_ICMPEchoRequestAddr
 
     return WDRV_WINC_STATUS_OK;
 }
+
+#ifndef WDRV_WINC_MOD_DISABLE_ICMP
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetAdd
+    (
+        DRV_HANDLE handle,
+        const WDRV_WINC_IP_MULTI_ADDRESS *const pIPAddr,
+        WDRV_WINC_IP_ADDRESS_TYPE ipAddrType,
+        uint8_t *const pTargetIdx
+    )
+
+  Summary:
+    Adds a target to the ping session.
+
+  Description:
+    Adds an address to the set of targets sent echo requests by the ping session.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetAdd
+(
+    DRV_HANDLE handle,
+    const WDRV_WINC_IP_MULTI_ADDRESS *const pIPAddr,
+    WDRV_WINC_IP_ADDRESS_TYPE ipAddrType,
+    uint8_t *const pTargetIdx
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+    uint8_t i;
+
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pIPAddr) || (NULL == pTargetIdx))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    if ((WDRV_WINC_IP_ADDRESS_TYPE_IPV4 != ipAddrType) && (WDRV_WINC_IP_ADDRESS_TYPE_IPV6 != ipAddrType))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    for (i=0; i<WDRV_WINC_PING_TARGET_NUM; i++)
+    {
+        WDRV_WINC_PING_TARGET *pTarget = &pDcpt->pCtrl->pingSession.targets[i];
+
+        if (false == pTarget->inUse)
+        {
+            (void)memset(pTarget, 0, sizeof(WDRV_WINC_PING_TARGET));
+            (void)memcpy(&pTarget->ipAddr, pIPAddr, sizeof(WDRV_WINC_IP_MULTI_ADDRESS));
+
+            pTarget->ipAddrType = ipAddrType;
+            pTarget->inUse      = true;
+
+            *pTargetIdx = i;
+
+            return WDRV_WINC_STATUS_OK;
+        }
+    }
+
+    return WDRV_WINC_STATUS_NO_SPACE;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetRemove
+    (
+        DRV_HANDLE handle,
+        uint8_t targetIdx
+    )
+
+  Summary:
+    Removes a target from the ping session.
+
+  Description:
+    Removes a target and its statistics from the ping session.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionTargetRemove
+(
+    DRV_HANDLE handle,
+    uint8_t targetIdx
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (targetIdx >= WDRV_WINC_PING_TARGET_NUM))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    pDcpt->pCtrl->pingSession.targets[targetIdx].inUse = false;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStart
+    (
+        DRV_HANDLE handle,
+        uint32_t intervalMs,
+        uint32_t timeoutMs,
+        const WDRV_WINC_PING_RESULT_CALLBACK pfResultCB
+    )
+
+  Summary:
+    Starts the ping session.
+
+  Description:
+    Starts sending periodic echo requests to all ping session targets.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStart
+(
+    DRV_HANDLE handle,
+    uint32_t intervalMs,
+    uint32_t timeoutMs,
+    const WDRV_WINC_PING_RESULT_CALLBACK pfResultCB
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+    WDRV_WINC_PING_SESSION *pSession;
+    uint8_t i;
+
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (0U == intervalMs) || (0U == timeoutMs))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    pSession = &pDcpt->pCtrl->pingSession;
+
+    for (i=0; i<WDRV_WINC_PING_TARGET_NUM; i++)
+    {
+        pSession->targets[i].outstanding  = false;
+        pSession->targets[i].cmdReqHandle = WINC_CMD_REQ_INVALID_HANDLE;
+    }
+
+    pSession->intervalMs = intervalMs;
+    pSession->timeoutMs  = timeoutMs;
+    pSession->pfResultCB = pfResultCB;
+    pSession->roundDue   = true;
+    pSession->active     = true;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStop(DRV_HANDLE handle)
+
+  Summary:
+    Stops the ping session.
+
+  Description:
+    Stops sending echo requests, targets and statistics are retained.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStop(DRV_HANDLE handle)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    pDcpt->pCtrl->pingSession.active = false;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStatsGet
+    (
+        DRV_HANDLE handle,
+        uint8_t targetIdx,
+        WDRV_WINC_PING_STATS *const pStats
+    )
+
+  Summary:
+    Retrieves ping session target statistics.
+
+  Description:
+    Calculates the statistics for a ping session target from its history.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_ICMPPingSessionStatsGet
+(
+    DRV_HANDLE handle,
+    uint8_t targetIdx,
+    WDRV_WINC_PING_STATS *const pStats
+)
+{
+    const WDRV_WINC_DCPT *const pDcpt = (const WDRV_WINC_DCPT *const)handle;
+    const WDRV_WINC_PING_TARGET *pTarget;
+    uint32_t rttSum    = 0;
+    uint32_t jitterSum = 0;
+    uint16_t prevRtt   = WDRV_WINC_PING_RTT_LOST;
+    uint8_t numJitter  = 0;
+    uint8_t idx;
+    uint8_t i;
+
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pStats) || (targetIdx >= WDRV_WINC_PING_TARGET_NUM))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    pTarget = &pDcpt->pCtrl->pingSession.targets[targetIdx];
+
+    if (false == pTarget->inUse)
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    (void)memset(pStats, 0, sizeof(WDRV_WINC_PING_STATS));
+
+    pStats->sent       = pTarget->sent;
+    pStats->received   = pTarget->received;
+    pStats->numSamples = pTarget->historyCount;
+    pStats->minRtt     = WDRV_WINC_PING_RTT_LOST;
+
+    /* Walk the history from oldest to newest. */
+    idx = (uint8_t)((pTarget->historyHead + WDRV_WINC_PING_HISTORY_NUM - pTarget->historyCount) % WDRV_WINC_PING_HISTORY_NUM);
+
+    for (i=0; i<pTarget->historyCount; i++)
+    {
+        uint16_t rtt = pTarget->history[idx];
+
+        idx = (uint8_t)((idx + 1U) % WDRV_WINC_PING_HISTORY_NUM);
+
+        if (WDRV_WINC_PING_RTT_LOST == rtt)
+        {
+            pStats->numLost++;
+            continue;
+        }
+
+        if (rtt < pStats->minRtt)
+        {
+            pStats->minRtt = rtt;
+        }
+
+        if (rtt > pStats->maxRtt)
+        {
+            pStats->maxRtt = rtt;
+        }
+
+        rttSum += rtt;
+
+        if (WDRV_WINC_PING_RTT_LOST != prevRtt)
+        {
+            jitterSum += (rtt > prevRtt) ? (uint32_t)(rtt - prevRtt) : (uint32_t)(prevRtt - rtt);
+            numJitter++;
+        }
+
+        prevRtt = rtt;
+    }
+
+    if (pStats->numSamples > pStats->numLost)
+    {
+        pStats->avgRtt = (uint16_t)(rttSum / (uint32_t)(pStats->numSamples - pStats->numLost));
+    }
+    else
+    {
+        pStats->minRtt = 0;
+    }
+
+    if (numJitter > 0U)
+    {
+        pStats->jitter = (uint16_t)(jitterSum / numJitter);
+    }
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    void WDRV_WINC_ICMPPingSessionTasks(DRV_HANDLE handle)
+
+  Summary:
+    Ping session state machine.
+
+  Description:
+    Sends echo requests when due and records lost requests.
+
+  Remarks:
+    See wdrv_winc_socket.h for usage information.
+
+*/
+
+void WDRV_WINC_ICMPPingSessionTasks(DRV_HANDLE handle)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const)handle;
+    WDRV_WINC_PING_SESSION *pSession;
+    uint64_t now;
+    uint8_t i;
+
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl))
+    {
+        return;
+    }
+
+    pSession = &pDcpt->pCtrl->pingSession;
+
+    if (false == pSession->active)
+    {
+        return;
+    }
+
+    now = SYS_TIME_Counter64Get();
+
+    /* Record outstanding requests which have timed out as lost. */
+    for (i=0; i<WDRV_WINC_PING_TARGET_NUM; i++)
+    {
+        const WDRV_WINC_PING_TARGET *pTarget = &pSession->targets[i];
+
+        if ((true == pTarget->inUse) && (true == pTarget->outstanding))
+        {
+            if (pingSessionElapsedMS(now - pTarget->sendTime) >= pSession->timeoutMs)
+            {
+                pingSessionRecord(pDcpt, i, WDRV_WINC_PING_RTT_LOST);
+            }
+        }
+    }
+
+    if ((false == pSession->roundDue) && (pingSessionElapsedMS(now - pSession->roundTime) < pSession->intervalMs))
+    {
+        return;
+    }
+
+    pSession->roundDue  = false;
+    pSession->roundTime = now;
+
+    /* Send an echo request to every target without one outstanding. */
+    for (i=0; i<WDRV_WINC_PING_TARGET_NUM; i++)
+    {
+        WDRV_WINC_PING_TARGET *pTarget = &pSession->targets[i];
+        WINC_CMD_REQ_HANDLE cmdReqHandle;
+        WINC_TYPE typeTargetAddr;
+        size_t lenTargetAddr;
+
+        if ((false == pTarget->inUse) || (true == pTarget->outstanding))
+        {
+            continue;
+        }
+
+        if (WDRV_WINC_IP_ADDRESS_TYPE_IPV4 == pTarget->ipAddrType)
+        {
+            typeTargetAddr = WINC_TYPE_IPV4ADDR;
+            lenTargetAddr  = sizeof(WDRV_WINC_IPV4_ADDR);
+        }
+        else
+        {
+            typeTargetAddr = WINC_TYPE_IPV6ADDR;
+            lenTargetAddr  = sizeof(WDRV_WINC_IPV6_ADDR);
+        }
+
+        cmdReqHandle = WDRV_WINC_CmdReqInit(1, lenTargetAddr, pingSessionCmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+        if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
+        {
+            continue;
+        }
+
+        (void)WINC_CmdPING(cmdReqHandle, typeTargetAddr, (uintptr_t)&pTarget->ipAddr, lenTargetAddr, 0);
+
+        if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
+        {
+            continue;
+        }
+
+        pTarget->seqNum++;
+        pTarget->sent++;
+        pTarget->cmdReqHandle = cmdReqHandle;
+        pTarget->sendTime     = now;
+        pTarget->outstanding  = true;
+    }
+}
+#endif
@@ -77,18 +77,49 @@ Microchip or any third party.
     None.
 
   Remarks:
-    None.
+    Records the security type of a configuration recalled by
+      WDRV_WINC_BSSReconnect in the association information.
 
 */
 
 static void staWSTAProcessRsp(DRV_HANDLE handle, const WINC_DEV_EVENT_RSP_ELEMS *const pElems)
 {
-    const WDRV_WINC_DCPT *pDcpt = (const WDRV_WINC_DCPT *)handle;
+    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT *)handle;
 
     if ((NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pElems))
     {
         return;
     }
+
+    switch (pElems->rspId)
+    {
+        case WINC_CMD_ID_WSTAC:
+        {
+            WINC_DEV_FRACT_INT_TYPE id;
+            uint8_t secType;
+
+            if (2U != pElems->numElems)
+            {
+                break;
+            }
+
+            (void)WINC_CmdReadParamElem(&pElems->elems[0], WINC_TYPE_INTEGER_FRAC, &id, sizeof(id));
+
+            if (WINC_CFG_PARAM_ID_WSTA_SEC_TYPE == id.i)
+            {
+                if (sizeof(secType) == WINC_CmdReadParamElem(&pElems->elems[1], WINC_TYPE_INTEGER, &secType, sizeof(secType)))
+                {
+                    pDcpt->pCtrl->assocInfoSTA.authType = (WDRV_WINC_AUTH_TYPE)secType;
+                }
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
 }
 
 //*******************************************************************************
@@ -342,6 +373,7 @@ void WDRV_WINC_WSTAProcessAEC
             if (WDRV_WINC_CONN_STATE_CONNECTED != pCtrl->connectedState)
             {
                 pCtrl->connectedState = WDRV_WINC_CONN_STATE_CONNECTED;
+                pCtrl->fastReconnect  = false;
 
                 pCtrl->assocInfoSTA.handle = (DRV_HANDLE)pCtrl;
                 pCtrl->assocInfoSTA.rssi   = 0;
@@ -372,6 +404,28 @@ void WDRV_WINC_WSTAProcessAEC
 
             if (WDRV_WINC_CONN_STATE_CONNECTING == pCtrl->connectedState)
             {
+                if (true == pCtrl->fastReconnect)
+                {
+                    WINC_CMD_REQ_HANDLE cmdReqHandle;
+
+                    /* Directed join failed, fall back to a full scan for the SSID. */
+                    pCtrl->fastReconnect = false;
+
+                    cmdReqHandle = WDRV_WINC_CmdReqInit(3, 0, staWSTACmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+                    if (WINC_CMD_REQ_INVALID_HANDLE != cmdReqHandle)
+                    {
+                        (void)WINC_CmdWSTAC(cmdReqHandle, WINC_CFG_PARAM_ID_WSTA_BSSID, WINC_TYPE_MACADDR, 0, 0);
+                        (void)WINC_CmdWSTAC(cmdReqHandle, WINC_CFG_PARAM_ID_WSTA_CHANNEL, WINC_TYPE_INTEGER, (uintptr_t)WDRV_WINC_CID_ANY, 0);
+                        (void)WINC_CmdWSTA(cmdReqHandle, (int32_t)WINC_CONST_WSTA_STATE_ENABLE);
+
+                        if (true == WDRV_WINC_DevTransmitCmdReq(pCtrl->wincDevHandle, cmdReqHandle))
+                        {
+                            break;
+                        }
+                    }
+                }
+
                 pCtrl->connectedState = WDRV_WINC_CONN_STATE_DISCONNECTED;
 
                 if (NULL != pCtrl->pfConnectNotifyCB)
@@ -642,6 +696,7 @@ WDRV_WINC_STATUS WDRV_WINC_BSSConnect
 
     pDcpt->pCtrl->pfConnectNotifyCB = pfNotifyCallback;
     pDcpt->pCtrl->connectedState    = WDRV_WINC_CONN_STATE_CONNECTING;
+    pDcpt->pCtrl->fastReconnect     = false;
 
     pDcpt->pCtrl->assocInfoSTA.handle            = DRV_HANDLE_INVALID;
     pDcpt->pCtrl->assocInfoSTA.rssi              = 0;
@@ -705,6 +760,9 @@ WDRV_WINC_STATUS WDRV_WINC_BSSDisconnect(DRV_HANDLE handle)
         return WDRV_WINC_STATUS_REQUEST_ERROR;
     }
 
+    /* Do not fall back to a full scan once a disconnect is requested. */
+    pDcpt->pCtrl->fastReconnect = false;
+
     return WDRV_WINC_STATUS_OK;
 }
 
@@ -767,3 +825,164 @@ WDRV_WINC_STATUS WDRV_WINC_BSSRoamingConfigure
 
     return WDRV_WINC_STATUS_OK;
 }
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_BSSReconnectStore
+    (
+        DRV_HANDLE handle,
+        const char *pFilename
+    )
+
+  Summary:
+    Stores the current connection for a later fast reconnect.
+
+  Description:
+    Records the current BSSID and channel then archives the configuration.
+
+  Remarks:
+    See wdrv_winc_sta.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_BSSReconnectStore
+(
+    DRV_HANDLE handle,
+    const char *pFilename
+)
+{
+    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT *)handle;
+    WINC_CMD_REQ_HANDLE cmdReqHandle;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pFilename))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    /* Ensure the station is connected with a known BSS. */
+    if ((WDRV_WINC_CONN_STATE_CONNECTED != pDcpt->pCtrl->connectedState) || (false == pDcpt->pCtrl->assocInfoSTA.peerAddress.valid))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    cmdReqHandle = WDRV_WINC_CmdReqInit(2, 0, staWSTACmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+    if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    /* Pin the configuration to the current BSS so a recall performs a directed join. */
+    (void)WINC_CmdWSTAC(cmdReqHandle, WINC_CFG_PARAM_ID_WSTA_BSSID, WINC_TYPE_MACADDR, (uintptr_t)pDcpt->pCtrl->assocInfoSTA.peerAddress.addr, WDRV_WINC_MAC_ADDR_LEN);
+    (void)WINC_CmdWSTAC(cmdReqHandle, WINC_CFG_PARAM_ID_WSTA_CHANNEL, WINC_TYPE_INTEGER, (uintptr_t)pDcpt->pCtrl->opChannel, 0);
+
+    if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    return WDRV_WINC_CfgArchiveStore(handle, pFilename);
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_BSSReconnect
+    (
+        DRV_HANDLE handle,
+        const char *pFilename,
+        const WDRV_WINC_BSSCON_NOTIFY_CALLBACK pfNotifyCallback
+    )
+
+  Summary:
+    Fast reconnect to a previously stored BSS.
+
+  Description:
+    Recalls a stored configuration and performs a directed join.
+
+  Remarks:
+    See wdrv_winc_sta.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_BSSReconnect
+(
+    DRV_HANDLE handle,
+    const char *pFilename,
+    const WDRV_WINC_BSSCON_NOTIFY_CALLBACK pfNotifyCallback
+)
+{
+    WDRV_WINC_DCPT *pDcpt = (WDRV_WINC_DCPT *)handle;
+    WINC_CMD_REQ_HANDLE cmdReqHandle;
+    WDRV_WINC_STATUS status;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pFilename))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    /* Ensure WINC is not configured for Soft-AP. */
+    if (false != pDcpt->pCtrl->isAP)
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    /* Ensure WINC is not connected or attempting to connect. */
+    if (WDRV_WINC_CONN_STATE_DISCONNECTED != pDcpt->pCtrl->connectedState)
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    /* Restore SSID, security, BSSID and channel from the archive. */
+    status = WDRV_WINC_CfgArchiveRecall(handle, pFilename);
+
+    if (WDRV_WINC_STATUS_OK != status)
+    {
+        return status;
+    }
+
+    /* Unknown until the recalled security type is read back. */
+    pDcpt->pCtrl->assocInfoSTA.authType = WDRV_WINC_AUTH_TYPE_DEFAULT;
+
+    cmdReqHandle = WDRV_WINC_CmdReqInit(2, 0, staWSTACmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+    if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    /* Read back the recalled security type for the association information. */
+    (void)WINC_CmdWSTAC(cmdReqHandle, WINC_CFG_PARAM_ID_WSTA_SEC_TYPE, WINC_TYPE_INVALID, 0, 0);
+    (void)WINC_CmdWSTA(cmdReqHandle, (int32_t)WINC_CONST_WSTA_STATE_ENABLE);
+
+    if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    pDcpt->pCtrl->pfConnectNotifyCB = pfNotifyCallback;
+    pDcpt->pCtrl->connectedState    = WDRV_WINC_CONN_STATE_CONNECTING;
+    pDcpt->pCtrl->fastReconnect     = true;
+
+    pDcpt->pCtrl->assocInfoSTA.handle            = DRV_HANDLE_INVALID;
+    pDcpt->pCtrl->assocInfoSTA.rssi              = 0;
+    pDcpt->pCtrl->assocInfoSTA.peerAddress.valid = false;
+    pDcpt->pCtrl->assocInfoSTA.assocID           = 1;
+
+    return WDRV_WINC_STATUS_OK;
+}
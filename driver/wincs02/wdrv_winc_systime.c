@@ -145,6 +145,19 @@ static void timeCmdRspCallbackHandler
 
         case WINC_DEV_CMDREQ_EVENT_CMD_STATUS:
         {
+            const WINC_DEV_EVENT_STATUS_ARGS *pStatusInfo = (const WINC_DEV_EVENT_STATUS_ARGS*)eventArg;
+
+            if (NULL == pStatusInfo)
+            {
+                break;
+            }
+
+            if ((WINC_CMD_ID_TIME == pStatusInfo->rspCmdId) && (WINC_STATUS_OK != pStatusInfo->status))
+            {
+                /* No time will be reported, allow another synchronisation attempt. */
+                pDcpt->pCtrl->sysTimeHostClock.syncPending = false;
+            }
+
             break;
         }
 
@@ -161,6 +174,183 @@ static void timeCmdRspCallbackHandler
     }
 }
 
+//*******************************************************************************
+/*
+  Function:
+    static uint64_t systimeCountToMS(uint64_t count)
+
+  Summary:
+    Convert a system time counter difference to milliseconds.
+
+  Description:
+    Converts a 64-bit system time counter difference to milliseconds.
+
+  Precondition:
+    None.
+
+  Parameters:
+    count - Counter difference.
+
+  Returns:
+    Number of milliseconds.
+
+  Remarks:
+    SYS_TIME_CountToMS is limited to 32-bit counts which may wrap between
+      host clock synchronisations.
+
+*/
+
+static uint64_t systimeCountToMS(uint64_t count)
+{
+    return (count * 1000U) / SYS_TIME_FrequencyGet();
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static void systimeHostClockSync(WDRV_WINC_CTRLDCPT *pCtrl, uint32_t timeUTC)
+
+  Summary:
+    Synchronise the host clock.
+
+  Description:
+    Rebases the host clock on the time reported by the WINC and updates the
+      drift estimate.
+
+  Precondition:
+    None.
+
+  Parameters:
+    pCtrl   - Pointer to WINC control descriptor.
+    timeUTC - UTC time reported by the WINC.
+
+  Returns:
+    None.
+
+  Remarks:
+    Drift is measured against the first synchronisation so the one second
+      resolution of the WINC time has less effect as the baseline grows. A
+      step in the WINC time larger than the maximum drift, such as an SNTP
+      update, restarts the estimate.
+
+*/
+
+static void systimeHostClockSync(WDRV_WINC_CTRLDCPT *pCtrl, uint32_t timeUTC)
+{
+    WDRV_WINC_SYSTIME_HOST_CLOCK *pClock = &pCtrl->sysTimeHostClock;
+    uint64_t now = SYS_TIME_Counter64Get();
+    uint64_t halfSecond = SYS_TIME_FrequencyGet() / 2U;
+
+    /* The WINC reports whole seconds, assume it is midway through the second. */
+    now = (now > halfSecond) ? (now - halfSecond) : 0U;
+
+    pClock->syncPending = false;
+    pClock->stats.syncs++;
+
+    if (true == pClock->valid)
+    {
+        uint64_t hostMs = systimeCountToMS(now - pClock->firstCount);
+        int64_t errorMs = (((int64_t)timeUTC - (int64_t)pClock->firstUTC) * 1000) - (int64_t)hostMs;
+        int64_t maxErrorMs = 2000 + (int64_t)((hostMs * (uint64_t)WDRV_WINC_SYSTIME_DRIFT_MAX_PPM) / 1000000U);
+
+        if ((errorMs > maxErrorMs) || (errorMs < -maxErrorMs))
+        {
+            pClock->valid = false;
+        }
+        else if (hostMs >= WDRV_WINC_SYSTIME_DRIFT_MIN_BASELINE_MS)
+        {
+            int64_t driftPPM = (errorMs * 1000000) / (int64_t)hostMs;
+
+            if (driftPPM > WDRV_WINC_SYSTIME_DRIFT_MAX_PPM)
+            {
+                driftPPM = WDRV_WINC_SYSTIME_DRIFT_MAX_PPM;
+            }
+            else if (driftPPM < -WDRV_WINC_SYSTIME_DRIFT_MAX_PPM)
+            {
+                driftPPM = -WDRV_WINC_SYSTIME_DRIFT_MAX_PPM;
+            }
+            else
+            {
+                /* Within bounds. */
+            }
+
+            pClock->stats.driftPPM = (int32_t)driftPPM;
+        }
+        else
+        {
+            /* Baseline too short to estimate drift. */
+        }
+    }
+
+    if (false == pClock->valid)
+    {
+        pClock->firstUTC       = timeUTC;
+        pClock->firstCount     = now;
+        pClock->lastUTC        = timeUTC;
+        pClock->stats.driftPPM = 0;
+        pClock->valid          = true;
+    }
+
+    pClock->baseUTC   = timeUTC;
+    pClock->baseCount = now;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    static WDRV_WINC_STATUS systimeHostClockSyncRequest(WDRV_WINC_DCPT *const pDcpt)
+
+  Summary:
+    Request the time from the WINC.
+
+  Description:
+    Sends a time request to the WINC unless one is already outstanding.
+
+  Precondition:
+    WDRV_WINC_Initialize must have been called.
+    WDRV_WINC_Open must have been called to obtain a valid handle.
+
+  Parameters:
+    pDcpt - Pointer to WINC device descriptor.
+
+  Returns:
+    WDRV_WINC_STATUS_OK            - The request has been accepted.
+    WDRV_WINC_STATUS_REQUEST_ERROR - The request to the WINC was rejected.
+
+  Remarks:
+    The response is received as a +TIME AEC.
+
+*/
+
+static WDRV_WINC_STATUS systimeHostClockSyncRequest(WDRV_WINC_DCPT *const pDcpt)
+{
+    WINC_CMD_REQ_HANDLE cmdReqHandle;
+
+    if (true == pDcpt->pCtrl->sysTimeHostClock.syncPending)
+    {
+        return WDRV_WINC_STATUS_OK;
+    }
+
+    cmdReqHandle = WDRV_WINC_CmdReqInit(1, 0, timeCmdRspCallbackHandler, (uintptr_t)pDcpt);
+
+    if (WINC_CMD_REQ_INVALID_HANDLE == cmdReqHandle)
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    (void)WINC_CmdTIME(cmdReqHandle, WINC_CONST_TIME_FORMAT_UTC_UNIX);
+
+    if (false == WDRV_WINC_DevTransmitCmdReq(pDcpt->pCtrl->wincDevHandle, cmdReqHandle))
+    {
+        return WDRV_WINC_STATUS_REQUEST_ERROR;
+    }
+
+    pDcpt->pCtrl->sysTimeHostClock.syncPending = true;
+    pDcpt->pCtrl->sysTimeHostClock.stats.syncRequests++;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
 //*******************************************************************************
 /*
   Function:
@@ -206,10 +396,12 @@ void WDRV_WINC_TIMEProcessAEC
                 break;
             }
 
+            (void)WINC_CmdReadParamElem(&pElems->elems[0], WINC_TYPE_INTEGER_UNSIGNED, &timeUTC, sizeof(timeUTC));
+
+            systimeHostClockSync(pDcpt->pCtrl, timeUTC);
+
             if (NULL != pDcpt->pCtrl->pfSystemTimeGetCurrentCB)
             {
-                (void)WINC_CmdReadParamElem(&pElems->elems[0], WINC_TYPE_INTEGER_UNSIGNED, &timeUTC, sizeof(timeUTC));
-
                 pDcpt->pCtrl->pfSystemTimeGetCurrentCB((DRV_HANDLE)pDcpt, timeUTC);
             }
 
@@ -275,6 +467,11 @@ WDRV_WINC_STATUS WDRV_WINC_SystemTimeSetCurrent(DRV_HANDLE handle, uint32_t curT
         return WDRV_WINC_STATUS_REQUEST_ERROR;
     }
 
+    /* Time is being stepped, restart the host clock from the new time. */
+    pDcpt->pCtrl->sysTimeHostClock.valid = false;
+
+    systimeHostClockSync(pDcpt->pCtrl, curTime);
+
     return WDRV_WINC_STATUS_OK;
 }
 
@@ -338,4 +535,170 @@ WDRV_WINC_STATUS WDRV_WINC_SystemTimeGetCurrent
     return WDRV_WINC_STATUS_OK;
 }
 
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SystemTimeGetLocal
+    (
+        DRV_HANDLE handle,
+        uint32_t *const pTimeUTC
+    )
+
+  Summary:
+    Returns the current system time from the host clock.
+
+  Description:
+    Returns the current system time extrapolated from the last synchronisation
+      with the WINC.
+
+  Remarks:
+    See wdrv_winc_systime.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SystemTimeGetLocal
+(
+    DRV_HANDLE handle,
+    uint32_t *const pTimeUTC
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const )handle;
+    WDRV_WINC_SYSTIME_HOST_CLOCK *pClock;
+    uint64_t elapsedMs;
+    uint32_t timeUTC;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pTimeUTC))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    pClock = &pDcpt->pCtrl->sysTimeHostClock;
+
+    if (false == pClock->valid)
+    {
+        (void)systimeHostClockSyncRequest(pDcpt);
+
+        return WDRV_WINC_STATUS_RETRY_REQUEST;
+    }
+
+    elapsedMs = systimeCountToMS(SYS_TIME_Counter64Get() - pClock->baseCount);
+
+    /* Apply drift correction and extrapolate from the last synchronisation. */
+    timeUTC = pClock->baseUTC + (uint32_t)(((int64_t)elapsedMs + (((int64_t)elapsedMs * pClock->stats.driftPPM) / 1000000)) / 1000);
+
+    if (timeUTC < pClock->lastUTC)
+    {
+        timeUTC = pClock->lastUTC;
+    }
+
+    pClock->lastUTC = timeUTC;
+    pClock->stats.localReads++;
+
+    if (elapsedMs >= pClock->resyncIntervalMs)
+    {
+        (void)systimeHostClockSyncRequest(pDcpt);
+    }
+
+    *pTimeUTC = timeUTC;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SystemTimeResyncIntervalSet
+    (
+        DRV_HANDLE handle,
+        uint32_t intervalMs
+    )
+
+  Summary:
+    Sets the host clock resynchronisation interval.
+
+  Description:
+    Configures how often the host clock is resynchronised with the WINC.
+
+  Remarks:
+    See wdrv_winc_systime.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SystemTimeResyncIntervalSet
+(
+    DRV_HANDLE handle,
+    uint32_t intervalMs
+)
+{
+    WDRV_WINC_DCPT *const pDcpt = (WDRV_WINC_DCPT *const )handle;
+
+    /* Ensure the driver handle is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (0U == intervalMs))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    pDcpt->pCtrl->sysTimeHostClock.resyncIntervalMs = intervalMs;
+
+    return WDRV_WINC_STATUS_OK;
+}
+
+//*******************************************************************************
+/*
+  Function:
+    WDRV_WINC_STATUS WDRV_WINC_SystemTimeStatsGet
+    (
+        DRV_HANDLE handle,
+        WDRV_WINC_SYSTIME_STATS *const pStats
+    )
+
+  Summary:
+    Retrieves the host clock statistics.
+
+  Description:
+    Copies the host clock query and synchronisation counts.
+
+  Remarks:
+    See wdrv_winc_systime.h for usage information.
+
+*/
+
+WDRV_WINC_STATUS WDRV_WINC_SystemTimeStatsGet
+(
+    DRV_HANDLE handle,
+    WDRV_WINC_SYSTIME_STATS *const pStats
+)
+{
+    const WDRV_WINC_DCPT *const pDcpt = (const WDRV_WINC_DCPT *const )handle;
+
+    /* Ensure the driver handle and user pointer is valid. */
+    if ((DRV_HANDLE_INVALID == handle) || (NULL == pDcpt) || (NULL == pDcpt->pCtrl) || (NULL == pStats))
+    {
+        return WDRV_WINC_STATUS_INVALID_ARG;
+    }
+
+    /* Ensure the driver instance has been opened for use. */
+    if (false == pDcpt->isOpen)
+    {
+        return WDRV_WINC_STATUS_NOT_OPEN;
+    }
+
+    (void)memcpy(pStats, &pDcpt->pCtrl->sysTimeHostClock.stats, sizeof(WDRV_WINC_SYSTIME_STATS));
+
+    return WDRV_WINC_STATUS_OK;
+}
+
 //DOM-IGNORE-END